@@ -0,0 +1,87 @@
+// Command kyberbench runs the benchmarks of package util/bench and prints
+// one result per line, either as JSON objects or in the format of go test
+// -bench, which tools such as benchstat compare across commits:
+//
+//	kyberbench -label $(git rev-parse --short HEAD) -run 'Ed25519/Point' > new.json
+//	kyberbench -format bench > new.txt
+//
+// Standard testing flags such as -test.benchtime apply.
+package main
+
+import (
+	"encoding/json"
+	"flag"
+	"fmt"
+	"os"
+	"regexp"
+	"runtime"
+	"testing"
+
+	"github.com/dedis/kyber/util/bench"
+)
+
+// result is the JSON record of one benchmark.
+type result struct {
+	Name        string  `json:"name"`
+	Label       string  `json:"label,omitempty"`
+	N           int     `json:"n"`
+	NsPerOp     float64 `json:"ns_per_op"`
+	BytesPerOp  int64   `json:"bytes_per_op"`
+	AllocsPerOp int64   `json:"allocs_per_op"`
+	GoVersion   string  `json:"go"`
+	GOOS        string  `json:"goos"`
+	GOARCH      string  `json:"goarch"`
+	CPUs        int     `json:"cpus"`
+}
+
+func main() {
+	testing.Init()
+	run := flag.String("run", ".", "run only the benchmarks whose names match this regular expression")
+	format := flag.String("format", "json", "output format: json or bench")
+	label := flag.String("label", "", "label of the results in JSON output, e.g. a commit hash")
+	large := flag.Bool("large", false, "also run the protocol benchmarks beyond 64 participants")
+	list := flag.Bool("list", false, "list the benchmark names and exit")
+	flag.Parse()
+
+	re, err := regexp.Compile(*run)
+	if err != nil {
+		fmt.Fprintln(os.Stderr, "kyberbench:", err)
+		os.Exit(2)
+	}
+	if *format != "json" && *format != "bench" {
+		fmt.Fprintln(os.Stderr, "kyberbench: unknown format", *format)
+		os.Exit(2)
+	}
+
+	enc := json.NewEncoder(os.Stdout)
+	for _, bm := range bench.All(*large) {
+		if !re.MatchString(bm.Name) {
+			continue
+		}
+		if *list {
+			fmt.Println(bm.Name)
+			continue
+		}
+		r := testing.Benchmark(bm.F)
+		if r.N == 0 {
+			fmt.Fprintln(os.Stderr, "kyberbench: benchmark failed:", bm.Name)
+			os.Exit(1)
+		}
+		if *format == "bench" {
+			fmt.Printf("Benchmark%s\t%s\t%s\n", bm.Name, r.String(), r.MemString())
+			continue
+		}
+		_ = enc.Encode(result{
+			Name:        bm.Name,
+			Label:       *label,
+			N:           r.N,
+			NsPerOp:     float64(r.T.Nanoseconds()) / float64(r.N),
+			BytesPerOp:  r.AllocedBytesPerOp(),
+			AllocsPerOp: r.AllocsPerOp(),
+			GoVersion:   runtime.Version(),
+			GOOS:        runtime.GOOS,
+			GOARCH:      runtime.GOARCH,
+			CPUs:        runtime.GOMAXPROCS(0),
+		})
+	}
+}
@@ -20,6 +20,11 @@ type Marshaling interface {
 	// Encoded length of this object in bytes.
 	MarshalSize() int
 
+	// Append the encoding of this object to b and return the extended
+	// slice. It does not allocate when b has MarshalSize() bytes of spare
+	// capacity, so that many objects can be encoded into one buffer.
+	AppendBinary(b []byte) ([]byte, error)
+
 	// Encode the contents of this object and write it to an io.Writer.
 	MarshalTo(w io.Writer) (int, error)
 
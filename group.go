@@ -127,6 +127,81 @@ type AllowsVarTime interface {
 	AllowVarTime(bool)
 }
 
+// MultiScalarMultiplier allows callers to determine if a given kyber.Point
+// supports computing a whole linear combination of points at once, i.e.
+// the sum scalars[0]*points[0] + ... + scalars[n-1]*points[n-1], as used
+// for Lagrange interpolation in the exponent or for batch verification.
+// Implementations are expected to be significantly faster than the
+// equivalent sequence of Mul and Add, using e.g. Straus' or Pippenger's
+// multi-exponentiation algorithms.
+//
+// As with Mul, a nil entry in points denotes the standard base point.
+// MultiScalarMul sets the receiver to the result and returns it; it
+// panics if scalars and points differ in length.
+// Multi-scalar multiplication is typically implemented in variable time,
+// so it must only be used on public Scalars and Points, never on secret
+// ones. The util/msm package provides a generic fallback for groups
+// which do not implement this interface.
+type MultiScalarMultiplier interface {
+	MultiScalarMul(scalars []Scalar, points []Point) Point
+}
+
+// Precomputable allows callers to determine if a given kyber.Point supports
+// precomputing a table of its own multiples. After P.Precompute(), any
+// Mul(s, P) runs about as fast as a multiplication of the standard base
+// point, at the cost of the memory holding the table. This pays off for
+// points used as a base many times, such as a second commitment base or a
+// long-term public key. The table only applies to the value P had when
+// Precompute was called and is ignored once P is set to another value.
+type Precomputable interface {
+	Precompute()
+}
+
+// CofactorComparable allows callers to determine if a given kyber.Point
+// supports comparing points up to the small-order components an elliptic
+// curve with a cofactor h > 1 admits: P.EqualCofactor(Q) reports whether
+// [h]P == [h]Q. Verification equations checked this way (cofactored
+// verification) are insensitive to small-order components. Batch verifiers
+// which combine equations with random weights cannot reliably cancel such
+// components, and need to check the combined equation this way to agree
+// with the single verification they stand in for.
+type CofactorComparable interface {
+	EqualCofactor(p2 Point) bool
+}
+
+// SubgroupCheckable allows callers to determine if a given kyber.Point
+// supports checking whether it lies in the prime-order subgroup of a group
+// with a cofactor h > 1, i.e. has no small-order component. Protocols which
+// combine points supplied by other parties, such as secret shares, use it
+// to reject points whose small-order components would otherwise go
+// unnoticed by cofactored or batch verification. For points which pass
+// it, cofactored and exact verification equations agree.
+type SubgroupCheckable interface {
+	InPrimeOrderSubgroup() bool
+}
+
+// BatchUnmarshaler allows callers to determine if a given kyber.Group
+// supports decoding many points at once, faster than calling
+// UnmarshalBinary on each of them, e.g. by decompressing them in parallel.
+// UnmarshalPoints fails if any of the encodings is invalid.
+type BatchUnmarshaler interface {
+	UnmarshalPoints(bufs [][]byte) ([]Point, error)
+}
+
+// SliceAllocator allows callers to determine if a given kyber.Group
+// supports allocating many Points or Scalars at once. PointSlice(n) and
+// ScalarSlice(n) return n new Points or Scalars, as many calls to Point()
+// or Scalar() would, but laid out in one backing array, for a constant
+// number of heap allocations instead of n. The backing array lives as
+// long as any of its elements, so this suits values which live and die
+// together, such as the coefficients of a polynomial. The util/alloc
+// package provides a generic fallback for groups which do not implement
+// this interface.
+type SliceAllocator interface {
+	PointSlice(n int) []Point
+	ScalarSlice(n int) []Scalar
+}
+
 // Group interface represents a mathematical group
 // usable for Diffie-Hellman key exchange, ElGamal encryption,
 // and the related body of public-key cryptographic algorithms
@@ -47,6 +47,10 @@ func (P *basicPoint) MarshalBinary() ([]byte, error) {
 }
 
 // UnmarshalBinary decodes an Edwards curve point.
+func (P *basicPoint) AppendBinary(b []byte) ([]byte, error) {
+	return marshalling.PointAppendBinary(P, b)
+}
+
 func (P *basicPoint) UnmarshalBinary(b []byte) error {
 	return P.c.decodePoint(b, &P.x, &P.y)
 }
@@ -3,6 +3,7 @@
 package curve25519
 
 import (
+	"math/big"
 	"testing"
 
 	"github.com/dedis/kyber"
@@ -116,6 +117,23 @@ func TestCompareEd25519(t *testing.T) {
 		new(edwards25519.Curve))
 }
 
+func TestExtendedNewPoint(t *testing.T) {
+	rand := random.New()
+	for _, p := range []*Param{Param1174(), Param25519(), ParamE382(), Param41417(), ParamE521()} {
+		g := new(ExtendedCurve).Init(p, false)
+		P := g.Point().Pick(rand)
+		if !g.Point().Equal(g.Point().Null()) {
+			t.Fatalf("%s: new point is not the identity", p.Name)
+		}
+		if g.Point().Equal(P) || P.Equal(g.Point()) {
+			t.Fatalf("%s: new point compares equal to a random point", p.Name)
+		}
+		if !g.Point().Add(g.Point(), P).Equal(P) {
+			t.Fatalf("%s: adding a new point changes the result", p.Name)
+		}
+	}
+}
+
 // Test point hiding functionality
 
 func testHiding(g kyber.Group, k int) {
@@ -190,3 +208,68 @@ func BenchmarkElligator1(b *testing.B) {
 func BenchmarkElligator2(b *testing.B) {
 	testHiding(new(ExtendedCurve).Init(Param25519(), true), b.N)
 }
+
+func TestCompareProjectiveExtended1174(t *testing.T) {
+	test.CompareGroups(testSuite.XOF,
+		new(ProjectiveCurve).Init(Param1174(), false),
+		new(ExtendedCurve).Init(Param1174(), false))
+}
+
+// Test the generic mod.Int arithmetic of ExtendedCurve,
+// which the standard curves no longer use.
+func TestCompareExtendedGeneric(t *testing.T) {
+	for _, p := range []*Param{Param1174(), Param25519(), ParamE382()} {
+		test.CompareGroups(testSuite.XOF,
+			new(ExtendedCurve).init(p, false, nil),
+			new(ExtendedCurve).Init(p, false))
+	}
+}
+
+func TestFeField(t *testing.T) {
+	rand := random.New()
+	for _, p := range []*Param{Param1174(), Param25519(), ParamE382(),
+		Param41417(), ParamE521()} {
+		f := newFeField(&p.P)
+		if f == nil {
+			t.Fatal("no fixed-width field for", p.Name)
+		}
+
+		// weakly reduced inputs up to 2^(64n)-1
+		R := new(big.Int).Lsh(one, uint(64*f.n))
+		values := []*big.Int{big.NewInt(0), big.NewInt(1),
+			new(big.Int).Sub(&p.P, one), new(big.Int).Set(&p.P),
+			new(big.Int).Sub(R, one)}
+		for i := 0; i < 10; i++ {
+			values = append(values, random.Int(R, rand))
+		}
+		elem := func(v *big.Int) *feElement {
+			var z feElement
+			f.setLimbs(&z, v)
+			return &z
+		}
+		for _, a := range values {
+			for _, b := range values {
+				var z feElement
+				check := func(op string, want *big.Int) {
+					want.Mod(want, &p.P)
+					if got := f.toBig(&z); got.Cmp(want) != 0 {
+						t.Fatalf("%s: %s(%v, %v) = %v, want %v",
+							p.Name, op, a, b, got, want)
+					}
+				}
+				f.add(&z, elem(a), elem(b))
+				check("add", new(big.Int).Add(a, b))
+				f.sub(&z, elem(a), elem(b))
+				check("sub", new(big.Int).Sub(a, b))
+				f.mul(&z, elem(a), elem(b))
+				check("mul", new(big.Int).Mul(a, b))
+			}
+		}
+	}
+}
+
+var ext1174Bench = test.NewGroupBench(new(ExtendedCurve).Init(Param1174(), false))
+var extE521Bench = test.NewGroupBench(new(ExtendedCurve).Init(ParamE521(), false))
+
+func BenchmarkPointMulExtended1174(b *testing.B) { ext1174Bench.PointMul(b.N) }
+func BenchmarkPointMulExtendedE521(b *testing.B) { extE521Bench.PointMul(b.N) }
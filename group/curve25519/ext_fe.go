@@ -0,0 +1,252 @@
+// +build vartime
+
+package curve25519
+
+import (
+	"crypto/cipher"
+	"encoding/hex"
+	"io"
+	"math/big"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/group/internal/marshalling"
+	"github.com/dedis/kyber/group/mod"
+)
+
+// fePoint is the counterpart of extPoint for curves whose field has
+// a fixed-width feField backend: the same extended coordinates and
+// formulas, but with the coordinates stored inline as feElements.
+// Conversions to mod.Int only happen for encoding, decoding and the
+// other operations shared with the generic points.
+type fePoint struct {
+	X, Y, Z, T feElement
+	c          *ExtendedCurve
+}
+
+func (P *fePoint) initXY(x, y *big.Int, c kyber.Group) {
+	P.c = c.(*ExtendedCurve)
+	f := P.c.fe
+	f.fromBig(&P.X, x)
+	f.fromBig(&P.Y, y)
+	P.Z = feElement{1}
+	f.mul(&P.T, &P.X, &P.Y)
+}
+
+func (P *fePoint) getXY() (x, y *mod.Int) {
+	P.normalize()
+	f := P.c.fe
+	return mod.NewInt(f.toBig(&P.X), f.P), mod.NewInt(f.toBig(&P.Y), f.P)
+}
+
+func (P *fePoint) String() string {
+	buf, _ := P.MarshalBinary()
+	return hex.EncodeToString(buf)
+}
+
+func (P *fePoint) MarshalSize() int {
+	return P.c.PointLen()
+}
+
+func (P *fePoint) MarshalBinary() ([]byte, error) {
+	x, y := P.getXY()
+	return P.c.encodePoint(x, y), nil
+}
+
+func (P *fePoint) AppendBinary(b []byte) ([]byte, error) {
+	return marshalling.PointAppendBinary(P, b)
+}
+
+func (P *fePoint) UnmarshalBinary(b []byte) error {
+	var x, y mod.Int
+	if err := P.c.decodePoint(b, &x, &y); err != nil {
+		return err
+	}
+	P.initXY(&x.V, &y.V, P.c)
+	return nil
+}
+
+func (P *fePoint) MarshalTo(w io.Writer) (int, error) {
+	return marshalling.PointMarshalTo(P, w)
+}
+
+func (P *fePoint) UnmarshalFrom(r io.Reader) (int, error) {
+	return marshalling.PointUnmarshalFrom(P, r)
+}
+
+func (P *fePoint) HideLen() int {
+	return P.c.hide.HideLen()
+}
+
+func (P *fePoint) HideEncode(rand cipher.Stream) []byte {
+	return P.c.hide.HideEncode(P, rand)
+}
+
+func (P *fePoint) HideDecode(rep []byte) {
+	P.c.hide.HideDecode(P, rep)
+}
+
+// Equality test for two Points on the same curve,
+// without inversions as for extPoint.
+func (P1 *fePoint) Equal(CP2 kyber.Point) bool {
+	P2 := CP2.(*fePoint)
+	f := P1.c.fe
+	var t1, t2 feElement
+	f.mul(&t1, &P1.X, &P2.Z)
+	f.mul(&t2, &P2.X, &P1.Z)
+	if !f.equal(&t1, &t2) {
+		return false
+	}
+	f.mul(&t1, &P1.Y, &P2.Z)
+	f.mul(&t2, &P2.Y, &P1.Z)
+	return f.equal(&t1, &t2)
+}
+
+func (P *fePoint) Set(CP2 kyber.Point) kyber.Point {
+	*P = *CP2.(*fePoint)
+	return P
+}
+
+func (P *fePoint) Clone() kyber.Point {
+	P2 := *P
+	return &P2
+}
+
+func (P *fePoint) Null() kyber.Point {
+	*P = P.c.feNull
+	return P
+}
+
+func (P *fePoint) Base() kyber.Point {
+	*P = P.c.feBase
+	return P
+}
+
+func (P *fePoint) EmbedLen() int {
+	return P.c.embedLen()
+}
+
+// Normalize the point's representation to Z=1.
+func (P *fePoint) normalize() {
+	f := P.c.fe
+	one := feElement{1}
+	if f.equal(&P.Z, &one) {
+		return
+	}
+	var zi feElement
+	f.inv(&zi, &P.Z)
+	f.mul(&P.X, &P.X, &zi)
+	f.mul(&P.Y, &P.Y, &zi)
+	P.Z = one
+	f.mul(&P.T, &P.X, &P.Y)
+}
+
+func (P *fePoint) Embed(data []byte, rand cipher.Stream) kyber.Point {
+	P.c.embed(P, data, rand)
+	return P
+}
+
+func (P *fePoint) Pick(rand cipher.Stream) kyber.Point {
+	P.c.embed(P, nil, rand)
+	return P
+}
+
+// Extract embedded data from a point group element
+func (P *fePoint) Data() ([]byte, error) {
+	x, y := P.getXY()
+	return P.c.data(x, y)
+}
+
+// Add two points using the extended coordinate addition formulas.
+func (P *fePoint) Add(CP1, CP2 kyber.Point) kyber.Point {
+	P.add(CP1.(*fePoint), CP2.(*fePoint))
+	return P
+}
+
+func (P *fePoint) add(P1, P2 *fePoint) {
+	f := P1.c.fe
+	var A, B, C, D, E, F, G, H feElement
+
+	f.mul(&A, &P1.X, &P2.X)
+	f.mul(&B, &P1.Y, &P2.Y)
+	f.mul(&C, &P1.T, &P2.T)
+	f.mul(&C, &C, &P1.c.fd)
+	f.mul(&D, &P1.Z, &P2.Z)
+	f.add(&E, &P1.X, &P1.Y)
+	f.add(&F, &P2.X, &P2.Y)
+	f.mul(&E, &E, &F)
+	f.sub(&E, &E, &A)
+	f.sub(&E, &E, &B)
+	f.sub(&F, &D, &C)
+	f.add(&G, &D, &C)
+	f.mul(&H, &P1.c.fa, &A)
+	f.sub(&H, &B, &H)
+	f.mul(&P.X, &E, &F)
+	f.mul(&P.Y, &G, &H)
+	f.mul(&P.T, &E, &H)
+	f.mul(&P.Z, &F, &G)
+	P.c = P1.c
+}
+
+// Subtract points.
+func (P *fePoint) Sub(CP1, CP2 kyber.Point) kyber.Point {
+	var N fePoint
+	N.Neg(CP2)
+	P.add(CP1.(*fePoint), &N)
+	return P
+}
+
+// Find the negative of point A.
+// For Edwards curves, the negative of (x,y) is (-x,y).
+func (P *fePoint) Neg(CA kyber.Point) kyber.Point {
+	A := CA.(*fePoint)
+	f := A.c.fe
+	P.c = A.c
+	f.neg(&P.X, &A.X)
+	P.Y = A.Y
+	P.Z = A.Z
+	f.neg(&P.T, &A.T)
+	return P
+}
+
+// Point doubling, with the same formulas as extPoint.double.
+func (P *fePoint) double() {
+	f := P.c.fe
+	var A, B, C, D, E, F, G, H feElement
+
+	f.mul(&A, &P.X, &P.X)
+	f.mul(&B, &P.Y, &P.Y)
+	f.mul(&C, &P.Z, &P.Z)
+	f.add(&C, &C, &C)
+	f.mul(&D, &P.c.fa, &A)
+	f.add(&E, &P.X, &P.Y)
+	f.mul(&E, &E, &E)
+	f.sub(&E, &E, &A)
+	f.sub(&E, &E, &B)
+	f.add(&G, &D, &B)
+	f.sub(&F, &G, &C)
+	f.sub(&H, &D, &B)
+	f.mul(&P.X, &E, &F)
+	f.mul(&P.Y, &G, &H)
+	f.mul(&P.T, &E, &H)
+	f.mul(&P.Z, &F, &G)
+}
+
+// Multiply point p by scalar s using the repeated doubling method.
+func (P *fePoint) Mul(s kyber.Scalar, G kyber.Point) kyber.Point {
+	v := &s.(*mod.Int).V
+	var B fePoint
+	if G == nil {
+		B = P.c.feBase
+	} else {
+		B = *G.(*fePoint)
+	}
+	T := P.c.feNull
+	for i := v.BitLen() - 1; i >= 0; i-- {
+		T.double()
+		if v.Bit(i) != 0 {
+			T.add(&T, &B)
+		}
+	}
+	*P = T
+	return P
+}
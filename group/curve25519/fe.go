@@ -0,0 +1,208 @@
+// +build vartime
+
+package curve25519
+
+import (
+	"math/big"
+	"math/bits"
+)
+
+// feLimbs is the largest number of 64-bit limbs of a feElement,
+// enough for E-521.
+const feLimbs = 9
+
+// feElement is an element of a feField, stored inline as 64-bit limbs,
+// least significant first. Elements are only weakly reduced: any value
+// below 2^(64n) may stand for its residue modulo p.
+type feElement [feLimbs]uint64
+
+// feField implements arithmetic modulo a pseudo-Mersenne prime
+// p = 2^k - c with a small c, as used by all the curves in param.go,
+// on fixed-width elements of n limbs. Reductions multiply the high part
+// of a value by 2^(64n) mod p = c*2^(64n-k) and fold it into the low part,
+// which avoids both the divisions and the allocations of big.Int.
+// Like the rest of this package, it runs in variable time.
+type feField struct {
+	n    int    // number of limbs
+	k    uint   // p = 2^k - c
+	c    uint64 // p = 2^k - c
+	fold uint64 // 2^(64n) mod p
+	p    feElement
+	P    *big.Int
+}
+
+// newFeField returns the fixed-width field modulo P, or nil if P is not of
+// a supported form 2^k - c.
+func newFeField(P *big.Int) *feField {
+	k := uint(P.BitLen())
+	n := int(k+63) / 64
+	if n < 2 || n > feLimbs {
+		return nil
+	}
+	c := new(big.Int).Lsh(one, k)
+	c.Sub(c, P)
+	shift := uint(64*n) - k
+	if !c.IsUint64() || c.Sign() <= 0 || uint(c.BitLen())+shift > 62 {
+		return nil
+	}
+	f := &feField{n: n, k: k, c: c.Uint64(), P: new(big.Int).Set(P)}
+	f.fold = f.c << shift
+	f.setLimbs(&f.p, P)
+	return f
+}
+
+// foldCarry adds h*2^(64n) to z, i.e. h*fold modulo p.
+func (f *feField) foldCarry(z *feElement, h uint64) {
+	for h != 0 {
+		hi, lo := bits.Mul64(h, f.fold)
+		var c uint64
+		z[0], c = bits.Add64(z[0], lo, 0)
+		z[1], c = bits.Add64(z[1], hi, c)
+		for i := 2; i < f.n && c != 0; i++ {
+			z[i], c = bits.Add64(z[i], 0, c)
+		}
+		h = c
+	}
+}
+
+// add sets z = x + y.
+func (f *feField) add(z, x, y *feElement) {
+	var c uint64
+	for i := 0; i < f.n; i++ {
+		z[i], c = bits.Add64(x[i], y[i], c)
+	}
+	f.foldCarry(z, c)
+}
+
+// sub sets z = x - y.
+func (f *feField) sub(z, x, y *feElement) {
+	var b uint64
+	for i := 0; i < f.n; i++ {
+		z[i], b = bits.Sub64(x[i], y[i], b)
+	}
+	// A borrow leaves x - y + 2^(64n), which exceeds x - y by fold
+	// modulo p.
+	for b != 0 {
+		z[0], b = bits.Sub64(z[0], f.fold, 0)
+		for i := 1; i < f.n && b != 0; i++ {
+			z[i], b = bits.Sub64(z[i], 0, b)
+		}
+	}
+}
+
+// neg sets z = -x.
+func (f *feField) neg(z, x *feElement) {
+	var zero feElement
+	f.sub(z, &zero, x)
+}
+
+// mul sets z = x*y.
+func (f *feField) mul(z, x, y *feElement) {
+	var t [2 * feLimbs]uint64
+	n := f.n
+	for i := 0; i < n; i++ {
+		var c uint64
+		for j := 0; j < n; j++ {
+			hi, lo := bits.Mul64(x[i], y[j])
+			var cc uint64
+			lo, cc = bits.Add64(lo, t[i+j], 0)
+			hi += cc
+			lo, cc = bits.Add64(lo, c, 0)
+			hi += cc
+			t[i+j], c = lo, hi
+		}
+		t[i+n] = c
+	}
+
+	// z = low + high*fold, leaving a carry limb below fold+1
+	var c uint64
+	for i := 0; i < n; i++ {
+		hi, lo := bits.Mul64(t[n+i], f.fold)
+		var cc uint64
+		lo, cc = bits.Add64(lo, t[i], 0)
+		hi += cc
+		lo, cc = bits.Add64(lo, c, 0)
+		hi += cc
+		z[i], c = lo, hi
+	}
+	f.foldCarry(z, c)
+}
+
+// canonical sets z to the unique representative of x in [0, p).
+func (f *feField) canonical(z, x *feElement) {
+	*z = *x
+	top := f.k - uint(64*(f.n-1)) // bits used in the top limb
+	for {
+		h := z[f.n-1] >> top
+		if top == 64 || h == 0 {
+			break
+		}
+		z[f.n-1] &= 1<<top - 1
+		// h*2^k = h*c modulo p
+		hi, lo := bits.Mul64(h, f.c)
+		var c uint64
+		z[0], c = bits.Add64(z[0], lo, 0)
+		z[1], c = bits.Add64(z[1], hi, c)
+		for i := 2; i < f.n; i++ {
+			z[i], c = bits.Add64(z[i], 0, c)
+		}
+	}
+
+	// z < 2^k < 2p now
+	var d feElement
+	var b uint64
+	for i := 0; i < f.n; i++ {
+		d[i], b = bits.Sub64(z[i], f.p[i], b)
+	}
+	if b == 0 {
+		*z = d
+	}
+}
+
+// equal returns whether x and y stand for the same element.
+func (f *feField) equal(x, y *feElement) bool {
+	var a, b feElement
+	f.canonical(&a, x)
+	f.canonical(&b, y)
+	return a == b
+}
+
+// fromBig sets z to v mod p.
+func (f *feField) fromBig(z *feElement, v *big.Int) {
+	var t big.Int
+	f.setLimbs(z, t.Mod(v, f.P))
+}
+
+// setLimbs sets z to v, which must be a non-negative n-limb value.
+func (f *feField) setLimbs(z *feElement, v *big.Int) {
+	b := v.FillBytes(make([]byte, 8*f.n))
+	*z = feElement{}
+	for i := 0; i < f.n; i++ {
+		for j := 0; j < 8; j++ {
+			z[i] |= uint64(b[len(b)-1-8*i-j]) << (8 * uint(j))
+		}
+	}
+}
+
+// toBig returns the canonical value of x.
+func (f *feField) toBig(x *feElement) *big.Int {
+	var r feElement
+	f.canonical(&r, x)
+	b := make([]byte, 8*f.n)
+	for i := 0; i < f.n; i++ {
+		for j := 0; j < 8; j++ {
+			b[len(b)-1-8*i-j] = byte(r[i] >> (8 * uint(j)))
+		}
+	}
+	return new(big.Int).SetBytes(b)
+}
+
+// inv sets z = 1/x. It converts to big.Int, whose extended Euclidean
+// algorithm is much faster than an exponentiation here.
+func (f *feField) inv(z, x *feElement) {
+	v := f.toBig(x)
+	if v.ModInverse(v, f.P) == nil {
+		v.SetInt64(0)
+	}
+	f.fromBig(z, v)
+}
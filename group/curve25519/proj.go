@@ -43,6 +43,10 @@ func (P *projPoint) MarshalBinary() ([]byte, error) {
 	return P.c.encodePoint(&P.X, &P.Y), nil
 }
 
+func (P *projPoint) AppendBinary(b []byte) ([]byte, error) {
+	return marshalling.PointAppendBinary(P, b)
+}
+
 func (P *projPoint) UnmarshalBinary(b []byte) error {
 	P.Z.Init64(1, &P.c.P)
 	return P.c.decodePoint(b, &P.X, &P.Y)
@@ -45,6 +45,28 @@ func (c *Curve) Point() kyber.Point {
 	return P
 }
 
+// PointSlice returns n new Points on the Ed25519 curve, backed by a single
+// array. PointSlice implements the kyber.SliceAllocator interface.
+func (c *Curve) PointSlice(n int) []kyber.Point {
+	backing := make([]point, n)
+	points := make([]kyber.Point, n)
+	for i := range points {
+		points[i] = &backing[i]
+	}
+	return points
+}
+
+// ScalarSlice returns n new Scalars, backed by a single array. ScalarSlice
+// implements the kyber.SliceAllocator interface.
+func (c *Curve) ScalarSlice(n int) []kyber.Scalar {
+	backing := make([]scalar, n)
+	scalars := make([]kyber.Scalar, n)
+	for i := range scalars {
+		scalars[i] = &backing[i]
+	}
+	return scalars
+}
+
 // NewKey returns a formatted Ed25519 key (avoiding subgroup attack by requiring
 // it to be a multiple of 8). NewKey implements the kyber/util/key.Generator interface.
 func (c *Curve) NewKey(stream cipher.Stream) kyber.Scalar {
@@ -1,8 +1,11 @@
 package edwards25519
 
 import (
+	"bytes"
+	"strings"
 	"testing"
 
+	"github.com/dedis/kyber"
 	"github.com/dedis/kyber/util/test"
 )
 
@@ -11,6 +14,67 @@ var groupBench = test.NewGroupBench(tSuite)
 
 func TestSuite(t *testing.T) { test.SuiteTest(tSuite) }
 
+func TestAppendBinaryAllocs(t *testing.T) {
+	P := tSuite.Point().Pick(tSuite.RandomStream())
+	s := tSuite.Scalar().Pick(tSuite.RandomStream())
+	buf := make([]byte, 0, 64)
+	n := testing.AllocsPerRun(100, func() {
+		b, _ := P.AppendBinary(buf[:0])
+		b, _ = s.AppendBinary(b)
+	})
+	if n != 0 {
+		t.Errorf("AppendBinary makes %v allocations", n)
+	}
+}
+
+func TestPointEqual(t *testing.T) {
+	// The order-2 point (0,-1), which only vanishes up to the cofactor.
+	T := tSuite.Point()
+	if err := T.UnmarshalBinary(append([]byte{0xec}, append(bytes.Repeat([]byte{0xff}, 30), 0x7f)...)); err != nil {
+		t.Fatal(err)
+	}
+	for i := 0; i < 10; i++ {
+		P := tSuite.Point().Pick(tSuite.RandomStream())
+		Q := tSuite.Point().Pick(tSuite.RandomStream())
+
+		// P in another projective representation
+		P2 := tSuite.Point().Add(P, Q)
+		P2.Sub(P2, Q)
+		b1, _ := P.MarshalBinary()
+		b2, _ := P2.MarshalBinary()
+		if !bytes.Equal(b1, b2) || !P.Equal(P2) || !P2.Equal(P) {
+			t.Fatal("equal points compare different")
+		}
+		if P.Equal(Q) || P.Equal(tSuite.Point().Neg(P)) {
+			t.Fatal("different points compare equal")
+		}
+
+		// A point which was never set is not equal to every point.
+		Z := tSuite.Point()
+		if Z.Equal(P) || P.Equal(Z) || Z.Equal(tSuite.Point().Null()) {
+			t.Fatal("unset point compares equal")
+		}
+		if Z.(*point).EqualCofactor(P) || P.(*point).EqualCofactor(Z) {
+			t.Fatal("unset point equal up to the cofactor")
+		}
+
+		PT := tSuite.Point().Add(P2, T)
+		if P.Equal(PT) {
+			t.Fatal("points differing by a small-order point compare equal")
+		}
+		if !P.(*point).EqualCofactor(PT) || !PT.(*point).EqualCofactor(P) {
+			t.Fatal("points differing by a small-order point not equal up to the cofactor")
+		}
+		if P.(*point).EqualCofactor(Q) {
+			t.Fatal("different points equal up to the cofactor")
+		}
+
+		if !P.(*point).InPrimeOrderSubgroup() || PT.(*point).InPrimeOrderSubgroup() {
+			t.Fatal("wrong prime-order subgroup membership")
+		}
+	}
+}
+
 func BenchmarkScalarAdd(b *testing.B)    { groupBench.ScalarAdd(b.N) }
 func BenchmarkScalarSub(b *testing.B)    { groupBench.ScalarSub(b.N) }
 func BenchmarkScalarNeg(b *testing.B)    { groupBench.ScalarNeg(b.N) }
@@ -29,3 +93,119 @@ func BenchmarkPointBaseMul(b *testing.B) { groupBench.PointBaseMul(b.N) }
 func BenchmarkPointPick(b *testing.B)    { groupBench.PointPick(b.N) }
 func BenchmarkPointEncode(b *testing.B)  { groupBench.PointEncode(b.N) }
 func BenchmarkPointDecode(b *testing.B)  { groupBench.PointDecode(b.N) }
+
+func BenchmarkPointMulPrecomputed(b *testing.B) {
+	P := tSuite.Point().Pick(tSuite.RandomStream())
+	P.(*point).Precompute()
+	s := tSuite.Scalar().Pick(tSuite.RandomStream())
+	Q := tSuite.Point()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		Q.Mul(s, P)
+	}
+}
+
+func BenchmarkPointPrecompute(b *testing.B) {
+	P := tSuite.Point().Pick(tSuite.RandomStream()).(*point)
+	for i := 0; i < b.N; i++ {
+		P.table = nil
+		P.Precompute()
+	}
+}
+
+func BenchmarkPointEqual(b *testing.B) {
+	P := tSuite.Point().Pick(tSuite.RandomStream())
+	Q := tSuite.Point().Add(P, tSuite.Point().Null())
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		P.Equal(Q)
+	}
+}
+
+func testEncodedPoints(n int) ([]kyber.Point, [][]byte) {
+	points := make([]kyber.Point, n)
+	bufs := make([][]byte, n)
+	for i := range points {
+		points[i] = tSuite.Point().Pick(tSuite.RandomStream())
+		bufs[i], _ = points[i].MarshalBinary()
+	}
+	return points, bufs
+}
+
+// invalidEncoding returns a 32-byte string which is not a point encoding.
+func invalidEncoding() []byte {
+	b := make([]byte, 32)
+	for P := tSuite.Point(); P.UnmarshalBinary(b) == nil; b[0]++ {
+	}
+	return b
+}
+
+func TestUnmarshalPoints(t *testing.T) {
+	points, bufs := testEncodedPoints(100)
+	var _ kyber.BatchUnmarshaler = tSuite
+	decoded, err := tSuite.UnmarshalPoints(bufs)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for i := range points {
+		if !decoded[i].Equal(points[i]) {
+			t.Fatalf("point %d decoded incorrectly", i)
+		}
+	}
+
+	bufs[42] = invalidEncoding()
+	if _, err := tSuite.UnmarshalPoints(bufs); err == nil ||
+		!strings.HasPrefix(err.Error(), "point 42:") {
+		t.Fatal("invalid point not reported:", err)
+	}
+}
+
+func TestPointCache(t *testing.T) {
+	points, bufs := testEncodedPoints(20)
+	c := NewPointCache(10)
+	for k := 0; k < 2; k++ {
+		decoded, err := c.UnmarshalPoints(bufs)
+		if err != nil {
+			t.Fatal(err)
+		}
+		for i := range points {
+			if !decoded[i].Equal(points[i]) {
+				t.Fatalf("point %d decoded incorrectly", i)
+			}
+		}
+		// Returned points are copies.
+		decoded[0].Null()
+	}
+	if len(c.points) != 10 {
+		t.Fatalf("cache holds %d points instead of 10", len(c.points))
+	}
+
+	P, err := c.Unmarshal(bufs[0])
+	if err != nil || !P.Equal(points[0]) {
+		t.Fatal("cached point decoded incorrectly")
+	}
+
+	bufs[7] = invalidEncoding()
+	if _, err := c.UnmarshalPoints(bufs); err == nil ||
+		!strings.HasPrefix(err.Error(), "point 7:") {
+		t.Fatal("invalid point not reported:", err)
+	}
+}
+
+func BenchmarkUnmarshalPoints1000(b *testing.B) {
+	_, bufs := testEncodedPoints(1000)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		tSuite.UnmarshalPoints(bufs)
+	}
+}
+
+func BenchmarkPointCache1000(b *testing.B) {
+	_, bufs := testEncodedPoints(1000)
+	c := NewPointCache(1000)
+	c.UnmarshalPoints(bufs)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		c.UnmarshalPoints(bufs)
+	}
+}
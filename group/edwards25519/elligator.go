@@ -54,14 +54,14 @@ func PublicKeyToCurve25519(curve25519Public *[32]byte, publicKey *[32]byte) bool
 }
 
 // sqrtMinusA is sqrt(-486662)
-var sqrtMinusA = fieldElement{
+var sqrtMinusA = ref10Element{
 	12222970, 8312128, 11511410, -9067497, 15300785, 241793, -25456130, -14121551, 12187136, -3972024,
-}
+}.fe()
 
 // sqrtMinusHalf is sqrt(-1/2)
-var sqrtMinusHalf = fieldElement{
+var sqrtMinusHalf = ref10Element{
 	-17256545, 3971863, 28865457, -1750208, 27359696, -16640980, 12573105, 1002827, -163343, 11073975,
-}
+}.fe()
 
 // halfQMinus1Bytes is (2^255-20)/2 expressed in little endian form.
 var halfQMinus1Bytes = [32]byte{
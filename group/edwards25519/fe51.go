@@ -0,0 +1,201 @@
+// +build amd64,!ref10 arm64,!ref10
+
+package edwards25519
+
+import (
+	"encoding/binary"
+	"fmt"
+)
+
+// This file implements the field arithmetic on GF(2^255 - 19) with five
+// 51-bit limbs, computing products with 64x64 -> 128-bit multiplications,
+// which compile to single instructions on 64-bit platforms. It follows the
+// 64-bit backends of curve25519-dalek and Go's crypto/ed25519 and is about
+// twice as fast as the ref10 code.
+
+// fieldElement represents the integer t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+
+// 2^204 t[4]. Every operation leaves all limbs below 2^51 + 2^18, which any
+// operation accepts as input.
+type fieldElement [5]uint64
+
+const mask51 = 1<<51 - 1
+
+func feZero(fe *fieldElement) {
+	*fe = fieldElement{}
+}
+
+func feOne(fe *fieldElement) {
+	*fe = fieldElement{1}
+}
+
+// feCarry brings the limbs of h below 2^51 + 2^18, keeping its value.
+func feCarry(h *fieldElement) {
+	c0 := h[0] >> 51
+	c1 := h[1] >> 51
+	c2 := h[2] >> 51
+	c3 := h[3] >> 51
+	c4 := h[4] >> 51
+	h[0] = h[0]&mask51 + c4*19
+	h[1] = h[1]&mask51 + c0
+	h[2] = h[2]&mask51 + c1
+	h[3] = h[3]&mask51 + c2
+	h[4] = h[4]&mask51 + c3
+}
+
+func feAdd(dst, a, b *fieldElement) {
+	for i := range dst {
+		dst[i] = a[i] + b[i]
+	}
+	feCarry(dst)
+}
+
+// feSub sets dst = a - b, adding 2p to keep the limbs positive.
+func feSub(dst, a, b *fieldElement) {
+	dst[0] = a[0] + 0xFFFFFFFFFFFDA - b[0]
+	dst[1] = a[1] + 0xFFFFFFFFFFFFE - b[1]
+	dst[2] = a[2] + 0xFFFFFFFFFFFFE - b[2]
+	dst[3] = a[3] + 0xFFFFFFFFFFFFE - b[3]
+	dst[4] = a[4] + 0xFFFFFFFFFFFFE - b[4]
+	feCarry(dst)
+}
+
+func feNeg(h, f *fieldElement) {
+	var zero fieldElement
+	feSub(h, &zero, f)
+}
+
+func feCopy(dst, src *fieldElement) {
+	*dst = *src
+}
+
+// Replace (f,g) with (g,g) if b == 1;
+// replace (f,g) with (f,g) if b == 0.
+//
+// Preconditions: b in {0,1}.
+func feCMove(f, g *fieldElement, b int32) {
+	mask := -uint64(b)
+	for i := range f {
+		f[i] ^= mask & (f[i] ^ g[i])
+	}
+}
+
+// feFromBytes sets dst to the little-endian value of src, ignoring its top
+// bit.
+func feFromBytes(dst *fieldElement, src []byte) {
+	dst[0] = binary.LittleEndian.Uint64(src[0:8]) & mask51
+	dst[1] = binary.LittleEndian.Uint64(src[6:14]) >> 3 & mask51
+	dst[2] = binary.LittleEndian.Uint64(src[12:20]) >> 6 & mask51
+	dst[3] = binary.LittleEndian.Uint64(src[19:27]) >> 1 & mask51
+	dst[4] = binary.LittleEndian.Uint64(src[24:32]) >> 12 & mask51
+}
+
+// feToBytes marshals the canonical value of h, fully reduced modulo p, to s.
+func feToBytes(s *[32]byte, h *fieldElement) {
+	t := *h
+	feCarry(&t)
+
+	// t is below 2p, so subtracting p once if q = (t + 19) >> 255 is one
+	// fully reduces it.
+	q := (t[0] + 19) >> 51
+	q = (t[1] + q) >> 51
+	q = (t[2] + q) >> 51
+	q = (t[3] + q) >> 51
+	q = (t[4] + q) >> 51
+
+	// t - q*p = t + 19q - 2^255 q, dropping the 2^255 q at the top.
+	t[0] += 19 * q
+	t[1] += t[0] >> 51
+	t[0] &= mask51
+	t[2] += t[1] >> 51
+	t[1] &= mask51
+	t[3] += t[2] >> 51
+	t[2] &= mask51
+	t[4] += t[3] >> 51
+	t[3] &= mask51
+	t[4] &= mask51
+
+	binary.LittleEndian.PutUint64(s[0:8], t[0]|t[1]<<51)
+	binary.LittleEndian.PutUint64(s[8:16], t[1]>>13|t[2]<<38)
+	binary.LittleEndian.PutUint64(s[16:24], t[2]>>26|t[3]<<25)
+	binary.LittleEndian.PutUint64(s[24:32], t[3]>>39|t[4]<<12)
+}
+
+// shr51 returns x >> 51, which fits in 64 bits for the column sums below.
+func (x uint128) shr51() uint64 {
+	return x.hi<<13 | x.lo>>51
+}
+
+// feReduceWide sets h to the sum of the columns r[i]*2^(51i), carrying the
+// top column back as 2^255 = 19. For inputs bounded as above, the columns of
+// feMul and feSquare are below 2^109, so 19 times their carries fits in 64
+// bits.
+func feReduceWide(h *fieldElement, r *[5]uint128) {
+	c0 := r[0].shr51()
+	c1 := r[1].shr51()
+	c2 := r[2].shr51()
+	c3 := r[3].shr51()
+	c4 := r[4].shr51()
+	h[0] = r[0].lo&mask51 + c4*19
+	h[1] = r[1].lo&mask51 + c0
+	h[2] = r[2].lo&mask51 + c1
+	h[3] = r[3].lo&mask51 + c2
+	h[4] = r[4].lo&mask51 + c3
+	feCarry(h)
+}
+
+// feMul calculates h = f * g
+// Can overlap h with f or g.
+//
+// Schoolbook multiplication, where the limb products reaching past 2^255
+// are folded back multiplied by 19.
+func feMul(h, f, g *fieldElement) {
+	a0, a1, a2, a3, a4 := f[0], f[1], f[2], f[3], f[4]
+	b0, b1, b2, b3, b4 := g[0], g[1], g[2], g[3], g[4]
+	a1_19, a2_19, a3_19, a4_19 := a1*19, a2*19, a3*19, a4*19
+
+	var t uint128
+	var r [5]uint128
+	r[0] = madd(madd(madd(madd(madd(t, a0, b0), a1_19, b4), a2_19, b3), a3_19, b2), a4_19, b1)
+	r[1] = madd(madd(madd(madd(madd(t, a0, b1), a1, b0), a2_19, b4), a3_19, b3), a4_19, b2)
+	r[2] = madd(madd(madd(madd(madd(t, a0, b2), a1, b1), a2, b0), a3_19, b4), a4_19, b3)
+	r[3] = madd(madd(madd(madd(madd(t, a0, b3), a1, b2), a2, b1), a3, b0), a4_19, b4)
+	r[4] = madd(madd(madd(madd(madd(t, a0, b4), a1, b3), a2, b2), a3, b1), a4, b0)
+	feReduceWide(h, &r)
+}
+
+// feSquare calculates h = f*f
+// Can overlap h with f.
+func feSquare(h, f *fieldElement) {
+	l0, l1, l2, l3, l4 := f[0], f[1], f[2], f[3], f[4]
+	l0_2, l1_2 := l0*2, l1*2
+	l1_38, l2_38, l3_38 := l1*38, l2*38, l3*38
+	l3_19, l4_19 := l3*19, l4*19
+
+	var t uint128
+	var r [5]uint128
+	r[0] = madd(madd(madd(t, l0, l0), l1_38, l4), l2_38, l3)
+	r[1] = madd(madd(madd(t, l0_2, l1), l2_38, l4), l3_19, l3)
+	r[2] = madd(madd(madd(t, l0_2, l2), l1, l1), l3_38, l4)
+	r[3] = madd(madd(madd(t, l0_2, l3), l1_2, l2), l4_19, l4)
+	r[4] = madd(madd(madd(t, l0_2, l4), l1_2, l3), l2, l2)
+	feReduceWide(h, &r)
+}
+
+// feSquare2 sets h = 2 * f * f
+// Can overlap h with f.
+func feSquare2(h, f *fieldElement) {
+	feSquare(h, f)
+	feAdd(h, h, h)
+}
+
+func (fe *fieldElement) String() string {
+	s := "fieldElement{"
+	for i := range fe {
+		if i > 0 {
+			s += ", "
+		}
+		s += fmt.Sprintf("%d", fe[i])
+	}
+	s += "}"
+	return s
+}
@@ -0,0 +1,84 @@
+package edwards25519
+
+import (
+	"bytes"
+	"math/big"
+	"testing"
+
+	"github.com/dedis/kyber/util/random"
+)
+
+func checkField(t *testing.T, op string, fe *fieldElement, want *big.Int) {
+	var b [32]byte
+	feToBytes(&b, fe)
+	want = new(big.Int).Mod(want, prime)
+	if got := bigScalar(b[:]); got.Cmp(want) != 0 {
+		t.Fatalf("%s: got %v, want %v", op, got, want)
+	}
+}
+
+var fieldOps = []struct {
+	name string
+	f    func(z, x, y *fieldElement)
+	want func(x, y *big.Int) *big.Int
+}{
+	{"Add", feAdd, func(x, y *big.Int) *big.Int { return new(big.Int).Add(x, y) }},
+	{"Sub", feSub, func(x, y *big.Int) *big.Int { return new(big.Int).Sub(x, y) }},
+	{"Mul", feMul, func(x, y *big.Int) *big.Int { return new(big.Int).Mul(x, y) }},
+	{"Neg", func(z, x, y *fieldElement) { feNeg(z, x) },
+		func(x, y *big.Int) *big.Int { return new(big.Int).Neg(x) }},
+	{"Square", func(z, x, y *fieldElement) { feSquare(z, x) },
+		func(x, y *big.Int) *big.Int { return new(big.Int).Mul(x, x) }},
+	{"Square2", func(z, x, y *fieldElement) { feSquare2(z, x) },
+		func(x, y *big.Int) *big.Int { return new(big.Int).Lsh(new(big.Int).Mul(x, x), 1) }},
+	{"Invert", func(z, x, y *fieldElement) { feInvert(z, x) },
+		func(x, y *big.Int) *big.Int { return new(big.Int).ModInverse(x, prime) }},
+}
+
+// TestFieldAgainstBig checks the field arithmetic of the backend in use
+// against math/big, including repeated operations on unreduced limbs.
+func TestFieldAgainstBig(t *testing.T) {
+	rand := random.New()
+	var buf [64]byte
+	var x, y, z fieldElement
+	for i := 0; i < 200; i++ {
+		random.Bytes(buf[:], rand)
+		// also cover non-canonical encodings, from p to 2^255-1
+		if i%4 == 0 {
+			buf[0] |= 0xf0
+			copy(buf[1:32], bytes.Repeat([]byte{0xff}, 30))
+			buf[31] = 0x7f
+		}
+		feFromBytes(&x, buf[:32])
+		feFromBytes(&y, buf[32:])
+		buf[31] &= 0x7f
+		buf[63] &= 0x7f
+		bx, by := bigScalar(buf[:32]), bigScalar(buf[32:])
+
+		checkField(t, "FromBytes", &x, bx)
+		for _, op := range fieldOps {
+			op.f(&z, &x, &y)
+			checkField(t, op.name, &z, op.want(bx, by))
+		}
+
+		// a chain of additions and subtractions, as in the point formulas
+		feAdd(&z, &x, &y)
+		feAdd(&z, &z, &z)
+		feSub(&z, &z, &x)
+		feSub(&z, &y, &z)
+		feMul(&z, &z, &z)
+		w := new(big.Int).Sub(by, new(big.Int).Sub(new(big.Int).Lsh(new(big.Int).Add(bx, by), 1), bx))
+		checkField(t, "Chain", &z, w.Mul(w, w))
+	}
+}
+
+func TestFieldConstants(t *testing.T) {
+	// d = -121665/121666
+	dWant := new(big.Int).Mul(big.NewInt(-121665), new(big.Int).ModInverse(big.NewInt(121666), prime))
+	checkField(t, "d", &d, dWant)
+	checkField(t, "d2", &d2, new(big.Int).Lsh(dWant, 1))
+	var z fieldElement
+	feSquare(&z, &sqrtM1)
+	checkField(t, "sqrtM1", &z, big.NewInt(-1))
+	checkField(t, "paramA", &paramA, big.NewInt(486662))
+}
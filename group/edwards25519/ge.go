@@ -4,6 +4,8 @@
 
 package edwards25519
 
+import "crypto/subtle"
+
 // Group elements are members of the elliptic curve -x^2 + y^2 = 1 + d * x^2 *
 // y^2 where d = -121665/121666.
 //
@@ -148,6 +150,66 @@ func (p *extendedGroupElement) FromBytes(s []byte) bool {
 	return true
 }
 
+// Equal returns 1 if p and q represent the same point and 0 otherwise, in
+// constant time. Rather than encoding both points, which costs two field
+// inversions, it compares the affine coordinates by cross-multiplication:
+// X1*Z2 == X2*Z1 and Y1*Z2 == Y2*Z1. That check holds trivially when Z is
+// zero, as in a zero-valued element which was never set, so such elements
+// are compared by their encodings instead.
+func (p *extendedGroupElement) Equal(q *extendedGroupElement) int32 {
+	if feIsNonZero(&p.Z)&feIsNonZero(&q.Z) == 0 {
+		return p.equalEncoding(q)
+	}
+
+	var a, b fieldElement
+
+	feMul(&a, &p.X, &q.Z)
+	feMul(&b, &q.X, &p.Z)
+	feSub(&a, &a, &b)
+	diff := feIsNonZero(&a)
+
+	feMul(&a, &p.Y, &q.Z)
+	feMul(&b, &q.Y, &p.Z)
+	feSub(&a, &a, &b)
+	diff |= feIsNonZero(&a)
+	return diff ^ 1
+}
+
+// EqualCofactor returns 1 if p and q are equal up to a point of small order,
+// i.e. if [8](p-q) is the identity, and 0 otherwise, in constant time.
+// Elements with a zero Z, which are not valid points, are compared by their
+// encodings as in Equal.
+func (p *extendedGroupElement) EqualCofactor(q *extendedGroupElement) int32 {
+	if feIsNonZero(&p.Z)&feIsNonZero(&q.Z) == 0 {
+		return p.equalEncoding(q)
+	}
+
+	var c cachedGroupElement
+	var t completedGroupElement
+	var r projectiveGroupElement
+
+	q.ToCached(&c)
+	t.Sub(p, &c)
+	for i := 0; i < 3; i++ {
+		t.ToProjective(&r)
+		r.Double(&t)
+	}
+	t.ToProjective(&r)
+
+	// The identity is (0:1:1) up to the scaling by Z.
+	var a fieldElement
+	feSub(&a, &r.Y, &r.Z)
+	return (feIsNonZero(&r.X) | feIsNonZero(&a)) ^ 1
+}
+
+// equalEncoding returns 1 if p and q have the same encoding and 0 otherwise.
+func (p *extendedGroupElement) equalEncoding(q *extendedGroupElement) int32 {
+	var bp, bq [32]byte
+	p.ToBytes(&bp)
+	q.ToBytes(&bq)
+	return int32(subtle.ConstantTimeCompare(bp[:], bq[:]))
+}
+
 func (p *extendedGroupElement) String() string {
 	return "extendedGroupElement{\n\t" +
 		p.X.String() + ",\n\t" +
@@ -341,14 +403,15 @@ func negative(b int32) int32 {
 	return (b >> 31) & 1
 }
 
-func selectPreComputed(t *preComputedGroupElement, pos int32, b int32) {
+func selectPreComputed(t *preComputedGroupElement, table *[32][8]preComputedGroupElement,
+	pos int32, b int32) {
 	var minusT preComputedGroupElement
 	bNegative := negative(b)
 	bAbs := b - (((-bNegative) & b) << 1)
 
 	t.Zero()
 	for i := int32(0); i < 8; i++ {
-		t.CMove(&base[pos][i], equal(bAbs, i+1))
+		t.CMove(&table[pos][i], equal(bAbs, i+1))
 	}
 	minusT.Neg(t)
 	t.CMove(&minusT, bNegative)
@@ -361,6 +424,17 @@ func selectPreComputed(t *preComputedGroupElement, pos int32, b int32) {
 // Preconditions:
 //   a[31] <= 127
 func geScalarMultBase(h *extendedGroupElement, a *[32]byte) {
+	geScalarMultPrecomputed(h, a, &base)
+}
+
+// geScalarMultPrecomputed computes h = a*A, where table holds the
+// multiples j*256^i*A for 1 <= j <= 8 and 0 <= i < 32, as base does
+// for the Ed25519 base point.
+//
+// Preconditions:
+//   a[31] <= 127
+func geScalarMultPrecomputed(h *extendedGroupElement, a *[32]byte,
+	table *[32][8]preComputedGroupElement) {
 	var e [64]int8
 
 	for i, v := range a {
@@ -383,7 +457,7 @@ func geScalarMultBase(h *extendedGroupElement, a *[32]byte) {
 	var t preComputedGroupElement
 	var r completedGroupElement
 	for i := int32(1); i < 64; i += 2 {
-		selectPreComputed(&t, i/2, int32(e[i]))
+		selectPreComputed(&t, table, i/2, int32(e[i]))
 		r.MixedAdd(h, &t)
 		r.ToExtended(h)
 	}
@@ -400,7 +474,7 @@ func geScalarMultBase(h *extendedGroupElement, a *[32]byte) {
 	r.ToExtended(h)
 
 	for i := int32(0); i < 64; i += 2 {
-		selectPreComputed(&t, i/2, int32(e[i]))
+		selectPreComputed(&t, table, i/2, int32(e[i]))
 		r.MixedAdd(h, &t)
 		r.ToExtended(h)
 	}
@@ -0,0 +1,226 @@
+package edwards25519
+
+// Multi-scalar multiplication, i.e. computing
+//   h = a[0]*A[0] + a[1]*A[1] + ... + a[n-1]*A[n-1]
+// for public scalars a[i] and public points A[i].
+// Both algorithms below run in variable time.
+//
+// Small batches use Straus' interleaved method on width-5 non-adjacent forms,
+// sharing the 256 doublings among all points. Larger batches use Pippenger's
+// bucket method with signed digits, whose cost per point decreases as the
+// window, chosen from the batch size, grows.
+
+// strausThreshold is the batch size from which the bucket method
+// outperforms interleaved sliding windows.
+const strausThreshold = 190
+
+// geMultiScalarMultVartime computes h = sum_i a[i]*A[i].
+// Unlike geScalarMult, the scalars need not be reduced:
+// any 256-bit little-endian value is accepted.
+func geMultiScalarMultVartime(h *extendedGroupElement, a []*[32]byte,
+	A []*extendedGroupElement) {
+
+	if len(a) != len(A) {
+		panic("mismatched number of scalars and points")
+	}
+	if len(a) < strausThreshold {
+		geStrausVartime(h, a, A)
+	} else {
+		gePippengerVartime(h, a, A)
+	}
+}
+
+// scalarWords loads a 32-byte little-endian scalar into 64-bit words,
+// with zero words at the end to simplify reading windows across the top.
+func scalarWords(w *[6]uint64, a *[32]byte) {
+	for i := 0; i < 4; i++ {
+		w[i] = uint64(a[8*i]) | uint64(a[8*i+1])<<8 |
+			uint64(a[8*i+2])<<16 | uint64(a[8*i+3])<<24 |
+			uint64(a[8*i+4])<<32 | uint64(a[8*i+5])<<40 |
+			uint64(a[8*i+6])<<48 | uint64(a[8*i+7])<<56
+	}
+	w[4] = 0
+	w[5] = 0
+}
+
+// scalarWindow returns the width bits of w starting at bit position pos.
+func scalarWindow(w *[6]uint64, pos, width uint) uint64 {
+	i, b := pos/64, pos%64
+	return ((w[i] >> b) | (w[i+1] << (64 - b))) & (1<<width - 1)
+}
+
+// naf5 computes the width-5 non-adjacent form of a: every nonzero
+// digit is odd, lies between -15 and 15, and is followed by at
+// least four zero digits. One digit more than the bit length is
+// needed for unreduced 256-bit values.
+func naf5(r *[257]int8, a *[32]byte) {
+	var w [6]uint64
+	scalarWords(&w, a)
+
+	carry := uint64(0)
+	for pos := uint(0); pos < 257; {
+		window := carry + scalarWindow(&w, pos, 5)
+		if window&1 == 0 {
+			pos++
+			continue
+		}
+		if window < 16 {
+			carry = 0
+			r[pos] = int8(window)
+		} else {
+			carry = 1
+			r[pos] = int8(window) - 32
+		}
+		pos += 5
+	}
+}
+
+// oddMultiples fills Ai with A,3A,5A,...,15A in cached form.
+func oddMultiples(Ai *[8]cachedGroupElement, A *extendedGroupElement) {
+	var t completedGroupElement
+	var u, A2 extendedGroupElement
+
+	A.ToCached(&Ai[0])
+	A.Double(&t)
+	t.ToExtended(&A2)
+	for i := 0; i < 7; i++ {
+		t.Add(&A2, &Ai[i])
+		t.ToExtended(&u)
+		u.ToCached(&Ai[i+1])
+	}
+}
+
+// geStrausVartime computes h = sum_i a[i]*A[i] by interleaving
+// the width-5 NAF expansions of all scalars.
+func geStrausVartime(h *extendedGroupElement, a []*[32]byte,
+	A []*extendedGroupElement) {
+
+	nafs := make([][257]int8, len(a))
+	tables := make([][8]cachedGroupElement, len(a))
+	for i := range a {
+		naf5(&nafs[i], a[i])
+		oddMultiples(&tables[i], A[i])
+	}
+
+	// Skip the leading positions where all digits are zero.
+	top := -1
+	for i := range nafs {
+		for j := 256; j > top; j-- {
+			if nafs[i][j] != 0 {
+				top = j
+				break
+			}
+		}
+	}
+
+	var t completedGroupElement
+	var r projectiveGroupElement
+	h.Zero()
+	for j := top; j >= 0; j-- {
+		h.ToProjective(&r)
+		r.Double(&t)
+		t.ToExtended(h)
+
+		for i := range nafs {
+			d := nafs[i][j]
+			if d > 0 {
+				t.Add(h, &tables[i][d/2])
+				t.ToExtended(h)
+			} else if d < 0 {
+				t.Sub(h, &tables[i][(-d)/2])
+				t.ToExtended(h)
+			}
+		}
+	}
+}
+
+// pippengerWindow returns the digit width minimizing the approximate
+// number of point additions, (256/c + 1) * (n + 2^(c-1)),
+// of the bucket method over n points.
+func pippengerWindow(n int) uint {
+	best, bestCost := uint(4), -1
+	for c := uint(4); c <= 16; c++ {
+		cost := (256/int(c) + 1) * (n + 1<<(c-1))
+		if bestCost < 0 || cost < bestCost {
+			best, bestCost = c, cost
+		}
+	}
+	return best
+}
+
+// gePippengerVartime computes h = sum_i a[i]*A[i] with the bucket method.
+// Each scalar is recoded into signed radix-2^c digits between -2^(c-1)
+// and 2^(c-1), so only 2^(c-1) buckets are needed per window: negative
+// digits subtract the point from the bucket of the absolute value.
+func gePippengerVartime(h *extendedGroupElement, a []*[32]byte,
+	A []*extendedGroupElement) {
+
+	c := pippengerWindow(len(a))
+	// The extra digit absorbs the final carry: for every c considered by
+	// pippengerWindow, it holds fewer than c-1 scalar bits and so never
+	// carries any further.
+	nd := int(256/c) + 1
+
+	digits := make([]int32, len(a)*nd)
+	var w [6]uint64
+	for i := range a {
+		scalarWords(&w, a[i])
+		carry := uint64(0)
+		for j := 0; j < nd; j++ {
+			window := carry + scalarWindow(&w, uint(j)*c, c)
+			carry = (window + 1<<(c-1)) >> c
+			digits[i*nd+j] = int32(window) - int32(carry<<c)
+		}
+	}
+
+	cached := make([]cachedGroupElement, len(A))
+	for i := range A {
+		A[i].ToCached(&cached[i])
+	}
+
+	buckets := make([]extendedGroupElement, 1<<(c-1))
+	var t completedGroupElement
+	var r projectiveGroupElement
+	var sum, total extendedGroupElement
+	var tc cachedGroupElement
+
+	h.Zero()
+	for j := nd - 1; j >= 0; j-- {
+		// h <<= c
+		for k := uint(0); k < c; k++ {
+			h.ToProjective(&r)
+			r.Double(&t)
+			t.ToExtended(h)
+		}
+
+		for b := range buckets {
+			buckets[b].Zero()
+		}
+		for i := range cached {
+			d := digits[i*nd+j]
+			if d > 0 {
+				t.Add(&buckets[d-1], &cached[i])
+				t.ToExtended(&buckets[d-1])
+			} else if d < 0 {
+				t.Sub(&buckets[-d-1], &cached[i])
+				t.ToExtended(&buckets[-d-1])
+			}
+		}
+
+		// total = sum_b (b+1)*buckets[b], computed as a sum of running sums.
+		sum.Zero()
+		total.Zero()
+		for b := len(buckets) - 1; b >= 0; b-- {
+			buckets[b].ToCached(&tc)
+			t.Add(&sum, &tc)
+			t.ToExtended(&sum)
+			sum.ToCached(&tc)
+			t.Add(&total, &tc)
+			t.ToExtended(&total)
+		}
+
+		total.ToCached(&tc)
+		t.Add(h, &tc)
+		t.ToExtended(h)
+	}
+}
@@ -0,0 +1,42 @@
+package edwards25519
+
+import (
+	"testing"
+
+	"github.com/dedis/kyber"
+	"github.com/stretchr/testify/require"
+)
+
+// Unreduced scalars, e.g. as decoded by UnmarshalBinary, must be handled
+// by both the Straus and the Pippenger code paths. Picked points lie in
+// the prime-order subgroup, so the expected result can be computed with
+// the reduced scalars.
+func TestMultiScalarMulUnreduced(t *testing.T) {
+	var ones [32]byte
+	for i := range ones {
+		ones[i] = 0xff
+	}
+	for _, n := range []int{1, 3, strausThreshold, strausThreshold + 1} {
+		scalars := make([]kyber.Scalar, n)
+		points := make([]kyber.Point, n)
+		exp := tSuite.Point().Null()
+		for i := range points {
+			scalars[i] = tSuite.Scalar().Pick(tSuite.RandomStream())
+			reduced := scalars[i]
+			if i%3 == 0 {
+				require.Nil(t, scalars[i].UnmarshalBinary(ones[:]))
+				reduced = tSuite.Scalar().SetBytes(ones[:])
+			} else if i%3 == 1 {
+				scalars[i] = primeOrderScalar.Clone()
+				reduced = tSuite.Scalar().Zero()
+			}
+			points[i] = tSuite.Point().Pick(tSuite.RandomStream())
+			if i == 1 {
+				points[i] = nil
+			}
+			exp.Add(exp, tSuite.Point().Mul(reduced, points[i]))
+		}
+		p := tSuite.Point().(kyber.MultiScalarMultiplier).MultiScalarMul(scalars, points)
+		require.True(t, exp.Equal(p), "n = ", n)
+	}
+}
@@ -0,0 +1,71 @@
+package edwards25519
+
+// fixedBaseTable holds the same kind of precomputed multiples of a point A
+// as base does for the Ed25519 base point, allowing geScalarMultPrecomputed
+// to multiply A at the speed of geScalarMultBase.
+// A point's table only applies while the point still equals ge,
+// the value it was computed from.
+type fixedBaseTable struct {
+	ge extendedGroupElement
+	t  [32][8]preComputedGroupElement
+}
+
+// newFixedBaseTable computes table[i][j] = (j+1)*256^i*A in affine
+// (y+x, y-x, 2dxy) form, sharing a single field inversion among all entries.
+func newFixedBaseTable(A *extendedGroupElement) *fixedBaseTable {
+	var multiples [32 * 8]extendedGroupElement
+	var t completedGroupElement
+	var r projectiveGroupElement
+	var c cachedGroupElement
+
+	Ai := *A // 256^i*A
+	for i := 0; i < 32; i++ {
+		Ai.ToCached(&c)
+		multiples[8*i] = Ai
+		for j := 1; j < 8; j++ {
+			t.Add(&multiples[8*i+j-1], &c)
+			t.ToExtended(&multiples[8*i+j])
+		}
+
+		// Ai <<= 8
+		Ai.ToProjective(&r)
+		for k := 0; k < 7; k++ {
+			r.Double(&t)
+			t.ToProjective(&r)
+		}
+		r.Double(&t)
+		t.ToExtended(&Ai)
+	}
+
+	// Montgomery's trick: invert the product of all Z coordinates once,
+	// then peel off the individual inverses.
+	var prefix [32 * 8]fieldElement
+	var inv, zi, x, y fieldElement
+	feOne(&inv)
+	for k := range multiples {
+		prefix[k] = inv
+		feMul(&inv, &inv, &multiples[k].Z)
+	}
+	feInvert(&inv, &inv)
+
+	tab := &fixedBaseTable{ge: *A}
+	for k := len(multiples) - 1; k >= 0; k-- {
+		feMul(&zi, &inv, &prefix[k])
+		feMul(&inv, &inv, &multiples[k].Z)
+
+		p := &tab.t[k/8][k%8]
+		feMul(&x, &multiples[k].X, &zi)
+		feMul(&y, &multiples[k].Y, &zi)
+		feAdd(&p.yPlusX, &y, &x)
+		feSub(&p.yMinusX, &y, &x)
+		feMul(&p.xy2d, &x, &y)
+		feMul(&p.xy2d, &p.xy2d, &d2)
+	}
+	return tab
+}
+
+// matches returns whether the table was computed from exactly the
+// representation A, so it can be used to multiply A.
+func (tab *fixedBaseTable) matches(A *extendedGroupElement) bool {
+	return tab.ge == *A
+}
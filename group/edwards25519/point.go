@@ -27,6 +27,7 @@ import (
 type point struct {
 	ge      extendedGroupElement
 	varTime bool
+	table   *fixedBaseTable // set by Precompute, only valid while it matches ge
 }
 
 func (P *point) String() string {
@@ -45,6 +46,12 @@ func (P *point) MarshalBinary() ([]byte, error) {
 	return b[:], nil
 }
 
+func (P *point) AppendBinary(b []byte) ([]byte, error) {
+	var buf [32]byte
+	P.ge.ToBytes(&buf)
+	return append(b, buf[:]...), nil
+}
+
 func (P *point) UnmarshalBinary(b []byte) error {
 	if !P.ge.FromBytes(b) {
 		return errors.New("invalid Ed25519 curve point")
@@ -62,27 +69,48 @@ func (P *point) UnmarshalFrom(r io.Reader) (int, error) {
 
 // Equality test for two Points on the same curve
 func (P *point) Equal(P2 kyber.Point) bool {
+	return P.ge.Equal(&P2.(*point).ge) == 1
+}
 
-	var b1, b2 [32]byte
-	P.ge.ToBytes(&b1)
-	P2.(*point).ge.ToBytes(&b2)
-	for i := range b1 {
-		if b1[i] != b2[i] {
-			return false
-		}
-	}
-	return true
+// EqualCofactor tests whether P and P2 are equal up to a point of small
+// order, i.e. whether [8]P == [8]P2. Verifiers may use it to check that
+// signatures or proofs hold in the prime-order subgroup, as batch
+// verification does, ignoring the small-order components P and P2 may have.
+func (P *point) EqualCofactor(P2 kyber.Point) bool {
+	return P.ge.EqualCofactor(&P2.(*point).ge) == 1
+}
+
+// InPrimeOrderSubgroup tests whether P lies in the subgroup of prime order
+// l generated by the base point, i.e. whether [l]P is the identity. It runs
+// in variable time, at about the cost of a multiplication.
+func (P *point) InPrimeOrderSubgroup() bool {
+	var lP, id extendedGroupElement
+	geMultiScalarMultVartime(&lP, []*[32]byte{&primeOrderScalar.v},
+		[]*extendedGroupElement{&P.ge})
+	id.Zero()
+	return lP.Equal(&id) == 1
 }
 
 // Set point to be equal to P2.
 func (P *point) Set(P2 kyber.Point) kyber.Point {
 	P.ge = P2.(*point).ge
+	P.table = P2.(*point).table
 	return P
 }
 
 // Set point to be equal to P2.
 func (P *point) Clone() kyber.Point {
-	return &point{ge: P.ge}
+	return &point{ge: P.ge, table: P.table}
+}
+
+// Precompute builds a table of multiples of P, about 30KB in size, so that
+// later multiplications of P by any scalar run in constant time at the speed
+// of multiplications of the base point. The table is shared with copies of P
+// made by Set and Clone, and is ignored once P is changed to another value.
+func (P *point) Precompute() {
+	if P.table == nil || !P.table.matches(&P.ge) {
+		P.table = newFixedBaseTable(&P.ge)
+	}
 }
 
 // Set to the neutral element, which is (0,1) for twisted Edwards curves.
@@ -212,6 +240,8 @@ func (P *point) Mul(s kyber.Scalar, A kyber.Point) kyber.Point {
 
 	if A == nil {
 		geScalarMultBase(&P.ge, a)
+	} else if tab := A.(*point).table; tab != nil && tab.matches(&A.(*point).ge) {
+		geScalarMultPrecomputed(&P.ge, a, &tab.t)
 	} else {
 		if P.varTime {
 			geScalarMultVartime(&P.ge, a, &A.(*point).ge)
@@ -222,3 +252,24 @@ func (P *point) Mul(s kyber.Scalar, A kyber.Point) kyber.Point {
 
 	return P
 }
+
+// MultiScalarMul sets P to the sum of scalars[i]*points[i], where a nil
+// point stands for the standard base point. It always runs in variable
+// time, so it must only be used with public scalars and points.
+func (P *point) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("mismatched number of scalars and points")
+	}
+	a := make([]*[32]byte, len(scalars))
+	A := make([]*extendedGroupElement, len(points))
+	for i := range scalars {
+		a[i] = &scalars[i].(*scalar).v
+		if points[i] == nil {
+			A[i] = &baseext
+		} else {
+			A[i] = &points[i].(*point).ge
+		}
+	}
+	geMultiScalarMultVartime(&P.ge, a, A)
+	return P
+}
@@ -0,0 +1,168 @@
+package edwards25519
+
+import (
+	"fmt"
+	"runtime"
+	"sync"
+
+	"github.com/dedis/kyber"
+)
+
+// Decompressing a point costs a field exponentiation computing the square
+// root of u/v, into which FromBytes already folds the inversion of v, so
+// there is no inversion left to share across a batch. UnmarshalPoints
+// instead spreads the decompressions over all CPUs, and PointCache avoids
+// them for encodings that are seen again and again.
+
+// minBatchPerCPU is the smallest number of points worth a goroutine.
+const minBatchPerCPU = 16
+
+// UnmarshalPoints decodes a batch of encoded points, in parallel on all
+// available CPUs. It fails if any of the encodings is invalid.
+func (c *Curve) UnmarshalPoints(bufs [][]byte) ([]kyber.Point, error) {
+	points := make([]point, len(bufs))
+	if i := unmarshalPoints(points, bufs); i >= 0 {
+		return nil, invalidPointError(i)
+	}
+	res := make([]kyber.Point, len(points))
+	for i := range points {
+		res[i] = &points[i]
+	}
+	return res, nil
+}
+
+// unmarshalPoints decodes bufs[i] into points[i] and returns the index of
+// the first invalid encoding, or -1 if all of them are valid.
+func unmarshalPoints(points []point, bufs [][]byte) int {
+	n := len(bufs)
+	workers := runtime.GOMAXPROCS(0)
+	if workers > n/minBatchPerCPU {
+		workers = n / minBatchPerCPU
+	}
+	if workers < 1 {
+		workers = 1
+	}
+
+	// first[w] is the index of the first invalid encoding in range w, or n
+	first := make([]int, workers)
+	var wg sync.WaitGroup
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func(w, lo, hi int) {
+			defer wg.Done()
+			first[w] = n
+			for i := lo; i < hi; i++ {
+				if !points[i].ge.FromBytes(bufs[i]) {
+					first[w] = i
+					return
+				}
+			}
+		}(w, w*n/workers, (w+1)*n/workers)
+	}
+	wg.Wait()
+
+	for _, i := range first {
+		if i < n {
+			return i
+		}
+	}
+	return -1
+}
+
+func invalidPointError(i int) error {
+	return fmt.Errorf("point %d: invalid Ed25519 curve point", i)
+}
+
+// PointCache remembers decoded points by their encoding, so that points
+// decoded repeatedly, such as long-term public keys, are decompressed only
+// once. It holds at most the number of points given to NewPointCache and
+// evicts arbitrary entries when full. A PointCache is safe for concurrent
+// use.
+type PointCache struct {
+	mu     sync.Mutex
+	size   int
+	points map[[32]byte]extendedGroupElement
+}
+
+// NewPointCache returns a cache holding up to size decoded points.
+func NewPointCache(size int) *PointCache {
+	return &PointCache{
+		size:   size,
+		points: make(map[[32]byte]extendedGroupElement, size),
+	}
+}
+
+// Unmarshal decodes the point encoded in buf, or returns a copy of it
+// from the cache.
+func (c *PointCache) Unmarshal(buf []byte) (kyber.Point, error) {
+	points, err := c.UnmarshalPoints([][]byte{buf})
+	if err != nil {
+		return nil, err
+	}
+	return points[0], nil
+}
+
+// UnmarshalPoints decodes a batch of encoded points like
+// Curve.UnmarshalPoints, taking the points it has already seen from the
+// cache. Every returned point is a fresh copy that the caller may modify.
+func (c *PointCache) UnmarshalPoints(bufs [][]byte) ([]kyber.Point, error) {
+	points := make([]point, len(bufs))
+	var missing []int
+
+	c.mu.Lock()
+	for i, b := range bufs {
+		var key [32]byte
+		if len(b) != len(key) {
+			c.mu.Unlock()
+			return nil, invalidPointError(i)
+		}
+		copy(key[:], b)
+		if ge, ok := c.points[key]; ok {
+			points[i].ge = ge
+		} else {
+			missing = append(missing, i)
+		}
+	}
+	c.mu.Unlock()
+
+	if len(missing) > 0 {
+		decoded := make([]point, len(missing))
+		missingBufs := make([][]byte, len(missing))
+		for j, i := range missing {
+			missingBufs[j] = bufs[i]
+		}
+		if j := unmarshalPoints(decoded, missingBufs); j >= 0 {
+			return nil, invalidPointError(missing[j])
+		}
+
+		c.mu.Lock()
+		for j, i := range missing {
+			points[i].ge = decoded[j].ge
+			c.add(bufs[i], &decoded[j].ge)
+		}
+		c.mu.Unlock()
+	}
+
+	res := make([]kyber.Point, len(points))
+	for i := range points {
+		res[i] = &points[i]
+	}
+	return res, nil
+}
+
+// add inserts a decoded point, evicting another one if the cache is full.
+// The caller must hold c.mu.
+func (c *PointCache) add(buf []byte, ge *extendedGroupElement) {
+	if c.size <= 0 {
+		return
+	}
+	var key [32]byte
+	copy(key[:], buf)
+	if _, ok := c.points[key]; !ok && len(c.points) >= c.size {
+		for k := range c.points {
+			delete(c.points, k)
+			break
+		}
+	}
+	c.points[key] = *ge
+}
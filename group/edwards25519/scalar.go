@@ -15,7 +15,6 @@ import (
 	"github.com/dedis/kyber"
 	"github.com/dedis/kyber/group/internal/marshalling"
 	"github.com/dedis/kyber/group/mod"
-	"github.com/dedis/kyber/util/random"
 )
 
 // This code is a port of the public domain, "ref10" implementation of ed25519
@@ -54,11 +53,27 @@ func (s *scalar) setInt(i *mod.Int) kyber.Scalar {
 
 // SetInt64 sets the scalar to a small integer value.
 func (s *scalar) SetInt64(v int64) kyber.Scalar {
-	return s.setInt(mod.NewInt64(v, primeOrder))
+	u := uint64(v)
+	if v < 0 {
+		u = -u
+	}
+	s.v = [32]byte{}
+	for i := 0; i < 8; i++ {
+		s.v[i] = byte(u >> (8 * uint(i)))
+	}
+	if v < 0 {
+		var z [32]byte
+		scSub(&s.v, &z, &s.v)
+	}
+	return s
 }
 
-func (s *scalar) toInt() *mod.Int {
-	return mod.NewIntBytes(s.v[:], primeOrder, mod.LittleEndian)
+// reduce writes the canonical encoding of s, i.e. its value reduced mod l,
+// to out. The value of s may be unreduced after UnmarshalBinary.
+func (s *scalar) reduce(out *[32]byte) {
+	var wide [64]byte
+	copy(wide[:], s.v[:])
+	scReduce(out, &wide)
 }
 
 // Set to the additive identity (0)
@@ -109,45 +124,61 @@ func (s *scalar) Div(a, b kyber.Scalar) kyber.Scalar {
 
 // Set to the modular inverse of scalar a
 func (s *scalar) Inv(a kyber.Scalar) kyber.Scalar {
-	var res scalar
-	res.One()
-	ac := a.(*scalar)
-	// Modular inversion in a multiplicative group is a^(phi(m)-1) = a^-1 mod m
-	// Since m is prime, phi(m) = m - 1 => a^(m-2) = a^-1 mod m.
-	// The inverse is computed using the exponentation-and-square algorithm.
-	// Implementation is constant time regarding the value a, it only depends on
-	// the modulo.
-	for i := 255; i >= 0; i-- {
-		bit := lMinus2.Bit(i)
-		// square step
-		scMul(&res.v, &res.v, &res.v)
-		if bit == 1 {
-			// multiply step
-			scMul(&res.v, &res.v, &ac.v)
-		}
-	}
-	s.v = res.v
+	// Since l is prime, a^(l-2) = a^-1 mod l. The exponentiation uses a
+	// fixed addition chain, so it runs in constant time regarding a.
+	var x scalar52
+	x.load(&a.(*scalar).v)
+	scInvert52(&x, &x)
+	x.store(&s.v)
 	return s
 }
 
 // Set to a fresh random or pseudo-random scalar
 func (s *scalar) Pick(rand cipher.Stream) kyber.Scalar {
-	i := mod.NewInt(random.Int(primeOrder, rand), primeOrder)
-	return s.setInt(i)
+	// Rejection sampling of 253-bit values different from zero and below l,
+	// consuming rand exactly like random.Int(primeOrder, rand) does.
+	var b [32]byte
+	for {
+		b = [32]byte{}
+		rand.XORKeyStream(b[:], b[:])
+		b[0] &= 0x1f
+		for i := range b {
+			s.v[i] = b[31-i]
+		}
+		if s.v != [32]byte{} && lessThanOrder(&s.v) {
+			return s
+		}
+	}
+}
+
+// lessThanOrder returns whether the little-endian value v is below l.
+// It runs in variable time.
+func lessThanOrder(v *[32]byte) bool {
+	l := &primeOrderScalar.v
+	for i := 31; i >= 0; i-- {
+		if v[i] != l[i] {
+			return v[i] < l[i]
+		}
+	}
+	return false
 }
 
 // SetBytes s to b, interpreted as a little endian integer.
 func (s *scalar) SetBytes(b []byte) kyber.Scalar {
-	return s.setInt(mod.NewIntBytes(b, primeOrder, mod.LittleEndian))
+	if len(b) > 64 {
+		return s.setInt(mod.NewIntBytes(b, primeOrder, mod.LittleEndian))
+	}
+	var wide [64]byte
+	copy(wide[:], b)
+	scReduce(&s.v, &wide)
+	return s
 }
 
 // String returns the string representation of this scalar (fixed length of 32 bytes, little endian).
 func (s *scalar) String() string {
-	b, _ := s.toInt().MarshalBinary()
-	for len(b) < 32 {
-		b = append(b, 0)
-	}
-	return hex.EncodeToString(b)
+	var b [32]byte
+	s.reduce(&b)
+	return hex.EncodeToString(b[:])
 }
 
 // Encoded length of this object in bytes.
@@ -157,7 +188,16 @@ func (s *scalar) MarshalSize() int {
 
 // MarshalBinary returns the binary representation of this scalar.
 func (s *scalar) MarshalBinary() ([]byte, error) {
-	return s.toInt().MarshalBinary()
+	var b [32]byte
+	s.reduce(&b)
+	return b[:], nil
+}
+
+// AppendBinary appends the binary representation of this scalar to b.
+func (s *scalar) AppendBinary(b []byte) ([]byte, error) {
+	var buf [32]byte
+	s.reduce(&buf)
+	return append(b, buf[:]...), nil
 }
 
 // UnmarshalBinary reads the binary representation of a scalar.
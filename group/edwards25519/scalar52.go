@@ -0,0 +1,239 @@
+package edwards25519
+
+import "math/bits"
+
+// This file implements arithmetic modulo the group order l on scalars
+// unpacked into five 52-bit limbs, using Montgomery multiplication with
+// R = 2^260, following the 64-bit scalar backend of curve25519-dalek.
+// A Montgomery multiplication costs about half of scMul, which pays off
+// for long chains of products staying in Montgomery form, i.e. inversion;
+// single products and reductions are left to the ref10 code.
+// All operations run in constant time.
+
+// scalar52 holds v[0] + v[1]*2^52 + ... + v[4]*2^208.
+type scalar52 [5]uint64
+
+const mask52 = 1<<52 - 1
+
+// scL is the group order l.
+var scL = scalar52{
+	0x0002631a5cf5d3ed, 0x000dea2f79cd6581, 0x000000000014def9,
+	0x0000000000000000, 0x0000100000000000,
+}
+
+// scLFactor is -1/l mod 2^52.
+const scLFactor = 0x51da312547e1b
+
+// scRR is R^2 mod l, with R = 2^260.
+var scRR = scalar52{
+	0x0009d265e952d13b, 0x000d63c715bea69f, 0x0005be65cb687604,
+	0x0003dceec73d217f, 0x000009411b7c309a,
+}
+
+// uint128 is an unsigned accumulator for sums of limb products.
+type uint128 struct {
+	hi, lo uint64
+}
+
+// madd returns x + a*b.
+func madd(x uint128, a, b uint64) uint128 {
+	hi, lo := bits.Mul64(a, b)
+	var c uint64
+	x.lo, c = bits.Add64(x.lo, lo, 0)
+	x.hi += hi + c
+	return x
+}
+
+// add128 returns x + y.
+func add128(x, y uint128) uint128 {
+	var c uint64
+	x.lo, c = bits.Add64(x.lo, y.lo, 0)
+	x.hi += y.hi + c
+	return x
+}
+
+// shr52 returns x >> 52.
+func (x uint128) shr52() uint128 {
+	return uint128{x.hi >> 52, x.hi<<12 | x.lo>>52}
+}
+
+// load unpacks a 32-byte little-endian value, which need not be reduced.
+func (s *scalar52) load(b *[32]byte) {
+	var w [4]uint64
+	for i := range w {
+		w[i] = uint64(b[8*i]) | uint64(b[8*i+1])<<8 |
+			uint64(b[8*i+2])<<16 | uint64(b[8*i+3])<<24 |
+			uint64(b[8*i+4])<<32 | uint64(b[8*i+5])<<40 |
+			uint64(b[8*i+6])<<48 | uint64(b[8*i+7])<<56
+	}
+	s[0] = w[0] & mask52
+	s[1] = (w[0]>>52 | w[1]<<12) & mask52
+	s[2] = (w[1]>>40 | w[2]<<24) & mask52
+	s[3] = (w[2]>>28 | w[3]<<36) & mask52
+	s[4] = w[3] >> 16
+}
+
+// store packs s, which must be fully carried, into 32 little-endian bytes.
+func (s *scalar52) store(b *[32]byte) {
+	w := [4]uint64{
+		s[0] | s[1]<<52,
+		s[1]>>12 | s[2]<<40,
+		s[2]>>24 | s[3]<<28,
+		s[3]>>36 | s[4]<<16,
+	}
+	for i := range w {
+		for j := 0; j < 8; j++ {
+			b[8*i+j] = byte(w[i] >> (8 * uint(j)))
+		}
+	}
+}
+
+// scSub52 sets s = a - b mod l, for a and b below l. It is used to
+// conditionally subtract l from values below 2l.
+func scSub52(s, a, b *scalar52) {
+	var d scalar52
+	borrow := uint64(0)
+	for i := range d {
+		borrow = a[i] - (b[i] + borrow>>63)
+		d[i] = borrow & mask52
+	}
+
+	// add l back if the difference is negative
+	underflow := -(borrow >> 63)
+	carry := uint64(0)
+	for i := range d {
+		carry = carry>>52 + d[i] + scL[i]&underflow
+		d[i] = carry & mask52
+	}
+	*s = d
+}
+
+// scMulInternal computes the schoolbook product of a and b.
+func scMulInternal(z *[9]uint128, a, b *scalar52) {
+	var t uint128
+	z[0] = madd(t, a[0], b[0])
+	z[1] = madd(madd(t, a[0], b[1]), a[1], b[0])
+	z[2] = madd(madd(madd(t, a[0], b[2]), a[1], b[1]), a[2], b[0])
+	z[3] = madd(madd(madd(madd(t, a[0], b[3]), a[1], b[2]), a[2], b[1]), a[3], b[0])
+	z[4] = madd(madd(madd(madd(madd(t, a[0], b[4]), a[1], b[3]), a[2], b[2]), a[3], b[1]), a[4], b[0])
+	z[5] = madd(madd(madd(madd(t, a[1], b[4]), a[2], b[3]), a[3], b[2]), a[4], b[1])
+	z[6] = madd(madd(madd(t, a[2], b[4]), a[3], b[3]), a[4], b[2])
+	z[7] = madd(madd(t, a[3], b[4]), a[4], b[3])
+	z[8] = madd(t, a[4], b[4])
+}
+
+// scSquareInternal computes the schoolbook square of a.
+func scSquareInternal(z *[9]uint128, a *scalar52) {
+	var t uint128
+	a0, a1, a2, a3 := 2*a[0], 2*a[1], 2*a[2], 2*a[3]
+	z[0] = madd(t, a[0], a[0])
+	z[1] = madd(t, a0, a[1])
+	z[2] = madd(madd(t, a0, a[2]), a[1], a[1])
+	z[3] = madd(madd(t, a0, a[3]), a1, a[2])
+	z[4] = madd(madd(madd(t, a0, a[4]), a1, a[3]), a[2], a[2])
+	z[5] = madd(madd(t, a1, a[4]), a2, a[3])
+	z[6] = madd(madd(t, a2, a[4]), a[3], a[3])
+	z[7] = madd(t, a3, a[4])
+	z[8] = madd(t, a[4], a[4])
+}
+
+// scMontgomeryReduce sets s = z / R mod l, for z < R*l.
+func scMontgomeryReduce(s *scalar52, z *[9]uint128) {
+	// Each step adds the multiple n*l of the modulus making the low limb
+	// divisible by 2^52. l[3] is zero, so its multiples are skipped.
+	var n [5]uint64
+	c := z[0]
+	n[0] = (c.lo * scLFactor) & mask52
+	c = madd(c, n[0], scL[0]).shr52()
+
+	c = madd(add128(c, z[1]), n[0], scL[1])
+	n[1] = (c.lo * scLFactor) & mask52
+	c = madd(c, n[1], scL[0]).shr52()
+
+	c = madd(madd(add128(c, z[2]), n[0], scL[2]), n[1], scL[1])
+	n[2] = (c.lo * scLFactor) & mask52
+	c = madd(c, n[2], scL[0]).shr52()
+
+	c = madd(madd(add128(c, z[3]), n[1], scL[2]), n[2], scL[1])
+	n[3] = (c.lo * scLFactor) & mask52
+	c = madd(c, n[3], scL[0]).shr52()
+
+	c = madd(madd(madd(add128(c, z[4]), n[0], scL[4]), n[2], scL[2]), n[3], scL[1])
+	n[4] = (c.lo * scLFactor) & mask52
+	c = madd(c, n[4], scL[0]).shr52()
+
+	// z is now divisible by R, so dividing just keeps the upper limbs.
+	var r scalar52
+	c = madd(madd(madd(add128(c, z[5]), n[1], scL[4]), n[3], scL[2]), n[4], scL[1])
+	r[0] = c.lo & mask52
+	c = madd(madd(add128(c.shr52(), z[6]), n[2], scL[4]), n[4], scL[2])
+	r[1] = c.lo & mask52
+	c = madd(add128(c.shr52(), z[7]), n[3], scL[4])
+	r[2] = c.lo & mask52
+	c = madd(add128(c.shr52(), z[8]), n[4], scL[4])
+	r[3] = c.lo & mask52
+	r[4] = c.shr52().lo
+
+	// The result is below 2l, so one conditional subtraction reduces it.
+	scSub52(s, &r, &scL)
+}
+
+// scMontgomeryMul sets s = a*b/R mod l. The product a*b must be below R*l,
+// which holds for any unpacked 32-byte values.
+func scMontgomeryMul(s, a, b *scalar52) {
+	var z [9]uint128
+	scMulInternal(&z, a, b)
+	scMontgomeryReduce(s, &z)
+}
+
+// scMontgomerySquare sets s = a*a/R mod l.
+func scMontgomerySquare(s, a *scalar52) {
+	var z [9]uint128
+	scSquareInternal(&z, a)
+	scMontgomeryReduce(s, &z)
+}
+
+// scInvert52 sets s = 1/a mod l, and zero if a is zero, by raising a to the
+// power l-2 with the addition chain from
+// https://briansmith.org/ecc-inversion-addition-chains-01#curve25519_scalar_inversion
+// in Montgomery form.
+func scInvert52(s, a *scalar52) {
+	var _1, _10, _100, _11, _101, _111, _1001, _1011, _1111, y scalar52
+
+	scMontgomeryMul(&_1, a, &scRR) // to Montgomery form
+	scMontgomerySquare(&_10, &_1)
+	scMontgomerySquare(&_100, &_10)
+	scMontgomeryMul(&_11, &_10, &_1)
+	scMontgomeryMul(&_101, &_10, &_11)
+	scMontgomeryMul(&_111, &_10, &_101)
+	scMontgomeryMul(&_1001, &_10, &_111)
+	scMontgomeryMul(&_1011, &_10, &_1001)
+	scMontgomeryMul(&_1111, &_100, &_1011)
+	scMontgomeryMul(&y, &_1111, &_1) // _10000
+
+	chain := [...]struct {
+		squarings int
+		x         *scalar52
+	}{
+		{123 + 3, &_101}, {2 + 2, &_11}, {1 + 4, &_1111}, {1 + 4, &_1111},
+		{4, &_1001}, {2, &_11}, {1 + 4, &_1111}, {1 + 3, &_101},
+		{3 + 3, &_101}, {3, &_111}, {1 + 4, &_1111}, {2 + 3, &_111},
+		{2 + 2, &_11}, {1 + 4, &_1011}, {2 + 4, &_1011}, {6 + 4, &_1001},
+		{2 + 2, &_11}, {3 + 2, &_11}, {3 + 2, &_11}, {1 + 4, &_1001},
+		{1 + 3, &_111}, {2 + 4, &_1111}, {1 + 4, &_1011}, {3, &_101},
+		{2 + 4, &_1111}, {3, &_101}, {1 + 2, &_11},
+	}
+	for _, step := range chain {
+		for i := 0; i < step.squarings; i++ {
+			scMontgomerySquare(&y, &y)
+		}
+		scMontgomeryMul(&y, &y, step.x)
+	}
+
+	// out of Montgomery form: y*1/R
+	var z [9]uint128
+	for i := range y {
+		z[i] = uint128{0, y[i]}
+	}
+	scMontgomeryReduce(s, &z)
+}
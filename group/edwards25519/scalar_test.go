@@ -1,6 +1,8 @@
 package edwards25519
 
 import (
+	"bytes"
+	"math/big"
 	"testing"
 
 	"github.com/dedis/kyber"
@@ -115,6 +117,79 @@ func TestSetBytesLE(t *testing.T) {
 	}
 }
 
+// bigScalar returns the little-endian value of b as a big.Int.
+func bigScalar(b []byte) *big.Int {
+	r := make([]byte, len(b))
+	for i := range b {
+		r[len(b)-1-i] = b[i]
+	}
+	return new(big.Int).SetBytes(r)
+}
+
+func checkScalar(t *testing.T, op string, s *scalar, want *big.Int) {
+	if got := bigScalar(s.v[:]); got.Cmp(want) != 0 {
+		t.Fatalf("%s: got %v, want %v", op, got, want)
+	}
+}
+
+func TestScalarAgainstBig(t *testing.T) {
+	rand := random.New()
+	var buf [64]byte
+	var x, y, z scalar
+	for i := 0; i < 200; i++ {
+		random.Bytes(buf[:], rand)
+		// also cover unreduced encodings, up to 2^256-1
+		if i%4 == 0 {
+			buf[31] = 0xff
+		}
+		copy(x.v[:], buf[:32])
+		copy(y.v[:], buf[32:])
+		bx, by := bigScalar(x.v[:]), bigScalar(y.v[:])
+
+		checkScalar(t, "Mul", z.Mul(&x, &y).(*scalar),
+			new(big.Int).Mod(new(big.Int).Mul(bx, by), primeOrder))
+		checkScalar(t, "Inv", z.Inv(&x).(*scalar),
+			new(big.Int).ModInverse(bx, primeOrder))
+		checkScalar(t, "Div", z.Div(&y, &x).(*scalar),
+			new(big.Int).Mod(new(big.Int).Mul(by,
+				new(big.Int).ModInverse(bx, primeOrder)), primeOrder))
+
+		n := i % 65
+		checkScalar(t, "SetBytes", z.SetBytes(buf[:n]).(*scalar),
+			new(big.Int).Mod(bigScalar(buf[:n]), primeOrder))
+
+		b, err := x.MarshalBinary()
+		if err != nil {
+			t.Fatal(err)
+		}
+		checkScalar(t, "MarshalBinary", z.SetBytes(b).(*scalar),
+			new(big.Int).Mod(bx, primeOrder))
+		if !bytes.Equal(b, z.v[:]) {
+			t.Fatal("MarshalBinary not canonical")
+		}
+	}
+
+	checkScalar(t, "Inv(0)", z.Inv(zero).(*scalar), new(big.Int))
+	for _, v := range []int64{0, 1, -1, 1 << 40, -1 << 63} {
+		checkScalar(t, "SetInt64", z.SetInt64(v).(*scalar),
+			new(big.Int).Mod(big.NewInt(v), primeOrder))
+	}
+	all := bytes.Repeat([]byte{0xff}, 100)
+	checkScalar(t, "SetBytes", z.SetBytes(all).(*scalar),
+		new(big.Int).Mod(bigScalar(all), primeOrder))
+}
+
+func TestScalarPickDistribution(t *testing.T) {
+	// Pick must keep drawing the same values as random.Int,
+	// so that scalars derived from a seeded stream do not change.
+	s1 := tSuite.XOF([]byte("pick"))
+	s2 := tSuite.XOF([]byte("pick"))
+	var x scalar
+	for i := 0; i < 50; i++ {
+		checkScalar(t, "Pick", x.Pick(s1).(*scalar), random.Int(primeOrder, s2))
+	}
+}
+
 func testSimple(t *testing.T, new func() kyber.Scalar) {
 	s1 := new()
 	s2 := new()
@@ -169,6 +244,14 @@ func benchScalarSub(b *testing.B, new func() kyber.Scalar) {
 	}
 }
 
+func BenchmarkScalarSetBytesWide(b *testing.B) {
+	buf := random.Bits(512, false, random.New())
+	s := new(scalar)
+	for i := 0; i < b.N; i++ {
+		s.SetBytes(buf)
+	}
+}
+
 // addition
 
 func BenchmarkCTScalarAdd(b *testing.B) { benchScalarAdd(b, tSuite.Scalar) }
@@ -20,6 +20,16 @@ func PointMarshalTo(p kyber.Point, w io.Writer) (int, error) {
 	return w.Write(buf)
 }
 
+// PointAppendBinary provides a generic implementation of Point.AppendBinary
+// based on Point.MarshalBinary, for points without a native one.
+func PointAppendBinary(p kyber.Point, b []byte) ([]byte, error) {
+	buf, err := p.MarshalBinary()
+	if err != nil {
+		return b, err
+	}
+	return append(b, buf...), nil
+}
+
 // PointUnmarshalFrom provides a generic implementation of Point.DecodeFrom,
 // based on Point.Decode, or Point.Pick if r is a Cipher or cipher.Stream.
 // The returned byte-count is valid only when decoding from a normal Reader,
@@ -328,6 +328,18 @@ func (i *Int) MarshalBinary() ([]byte, error) {
 	return b, nil
 }
 
+// AppendBinary appends the encoding of this Int, exactly MarshalSize() bytes
+// long and in i's ByteOrder, to b.
+func (i *Int) AppendBinary(b []byte) ([]byte, error) {
+	n := len(b)
+	b = append(b, make([]byte, i.MarshalSize())...)
+	buf := i.V.FillBytes(b[n:])
+	if i.BO == LittleEndian {
+		reverse(buf, buf)
+	}
+	return b, nil
+}
+
 // UnmarshalBinary tries to decode a Int from a byte-slice buffer.
 // Returns an error if the buffer is not exactly Len() bytes long
 // or if the contents of the buffer represents an out-of-range integer.
@@ -6,6 +6,7 @@ import (
 	"math/big"
 	"testing"
 
+	"github.com/dedis/kyber/internal/race"
 	"github.com/stretchr/testify/assert"
 )
 
@@ -88,3 +89,21 @@ func TestIntClone(t *testing.T) {
 		t.Error("Should not be equal")
 	}
 }
+
+func TestIntAppendBinary(t *testing.T) {
+	modulo := big.NewInt(65535)
+	for _, bo := range []ByteOrder{BigEndian, LittleEndian} {
+		i := NewInt64(0x1234, modulo)
+		i.BO = bo
+		exp, _ := i.MarshalBinary()
+		b, err := i.AppendBinary(make([]byte, 1, 3))
+		assert.Nil(t, err)
+		assert.Equal(t, append([]byte{0}, exp...), b)
+		if race.Enabled {
+			continue
+		}
+		assert.Equal(t, 0.0, testing.AllocsPerRun(10, func() {
+			_, _ = i.AppendBinary(b[:0])
+		}))
+	}
+}
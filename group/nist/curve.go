@@ -180,6 +180,17 @@ func (p *curvePoint) MarshalBinary() ([]byte, error) {
 	return elliptic.Marshal(p.c, p.x, p.y), nil
 }
 
+// AppendBinary appends the same encoding as MarshalBinary to b.
+func (p *curvePoint) AppendBinary(b []byte) ([]byte, error) {
+	n := len(b)
+	b = append(b, make([]byte, p.MarshalSize())...)
+	coordlen := (len(b) - n - 1) / 2
+	b[n] = 4 // uncompressed point
+	p.x.FillBytes(b[n+1 : n+1+coordlen])
+	p.y.FillBytes(b[n+1+coordlen:])
+	return b, nil
+}
+
 func (p *curvePoint) UnmarshalBinary(buf []byte) error {
 	// Check whether all bytes after first one are 0, so we
 	// just return the initial point. Read everything to
@@ -3,8 +3,15 @@
 package nist
 
 import (
+	"bytes"
+	"crypto/elliptic"
+	"math/big"
 	"testing"
 
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/group/mod"
+	"github.com/dedis/kyber/internal/race"
+	"github.com/dedis/kyber/util/random"
 	"github.com/dedis/kyber/util/test"
 )
 
@@ -16,6 +23,40 @@ var testP256 = NewBlakeSHA256P256()
 
 func TestP256(t *testing.T) { test.SuiteTest(testP256) }
 
+func TestAppendBinaryAllocs(t *testing.T) {
+	if race.Enabled {
+		t.Skip("the race detector makes extra allocations")
+	}
+	for _, g := range []kyber.Group{testP256, testQR512} {
+		P := g.Point().Pick(random.New())
+		s := g.Scalar().Pick(random.New())
+		buf := make([]byte, 0, P.MarshalSize()+s.MarshalSize())
+		n := testing.AllocsPerRun(100, func() {
+			b, _ := P.AppendBinary(buf[:0])
+			b, _ = s.AppendBinary(b)
+		})
+		if n != 0 {
+			t.Errorf("%s: AppendBinary makes %v allocations", g, n)
+		}
+	}
+}
+
+func TestP256NewPoint(t *testing.T) {
+	P := testP256.Point().Pick(random.New())
+	if !testP256.Point().Equal(testP256.Point().Null()) {
+		t.Fatal("new point is not the point at infinity")
+	}
+	if testP256.Point().Equal(P) || P.Equal(testP256.Point()) {
+		t.Fatal("new point compares equal to a random point")
+	}
+	Q := testP256.Point().Add(testP256.Point(), P)
+	b1, _ := P.MarshalBinary()
+	b2, _ := Q.MarshalBinary()
+	if !Q.Equal(P) || !bytes.Equal(b1, b2) {
+		t.Fatal("adding a new point changes the result")
+	}
+}
+
 func TestSetBytesBE(t *testing.T) {
 	s := testP256.Scalar()
 	s.SetBytes([]byte{0, 1, 2, 3})
@@ -26,6 +67,155 @@ func TestSetBytesBE(t *testing.T) {
 	}
 }
 
+func TestP256Field(t *testing.T) {
+	p := elliptic.P256().Params().P
+	R := new(big.Int).Lsh(big.NewInt(1), 256)
+	toBig := func(x *p256Element) *big.Int {
+		var b [32]byte
+		p256ToBytes(b[:], x)
+		return new(big.Int).SetBytes(b[:])
+	}
+	if toBig(&p256One).Cmp(big.NewInt(1)) != 0 {
+		t.Fatal("wrong one")
+	}
+	if v := toBig(&p256RR); v.Cmp(new(big.Int).Mod(R, p)) != 0 {
+		t.Fatal("wrong R^2")
+	}
+
+	rand := random.New()
+	values := []*big.Int{big.NewInt(0), big.NewInt(1), new(big.Int).Sub(p, big.NewInt(1))}
+	for i := 0; i < 20; i++ {
+		values = append(values, random.Int(p, rand))
+	}
+	for _, a := range values {
+		for _, b := range values {
+			x, y := p256FromBig(a), p256FromBig(b)
+			var z p256Element
+			check := func(op string, want *big.Int) {
+				if toBig(&z).Cmp(want.Mod(want, p)) != 0 {
+					t.Fatalf("%s(%v, %v) = %v, want %v", op, a, b, toBig(&z), want)
+				}
+			}
+			p256Add(&z, &x, &y)
+			check("add", new(big.Int).Add(a, b))
+			p256Sub(&z, &x, &y)
+			check("sub", new(big.Int).Sub(a, b))
+			p256Mul(&z, &x, &y)
+			check("mul", new(big.Int).Mul(a, b))
+		}
+		x := p256FromBig(a)
+		var z p256Element
+		p256Invert(&z, &x)
+		want := new(big.Int).ModInverse(a, p)
+		if want == nil {
+			want = new(big.Int)
+		}
+		if toBig(&z).Cmp(want) != 0 {
+			t.Fatalf("invert(%v) = %v, want %v", a, toBig(&z), want)
+		}
+	}
+}
+
+// TestP256Native checks the projective point arithmetic against
+// crypto/elliptic.
+func TestP256Native(t *testing.T) {
+	c := elliptic.P256()
+	rand := random.New()
+	affine := func(P kyber.Point) (*big.Int, *big.Int) {
+		b, _ := P.MarshalBinary()
+		return elliptic.Unmarshal(c, b)
+	}
+	point := func() (kyber.Point, *big.Int, *big.Int) {
+		s := testP256.Scalar().Pick(rand)
+		P := testP256.Point().Mul(s, nil)
+		// give the point a random Z coordinate
+		P.Add(P, testP256.Point().Null())
+		x, y := affine(P)
+		return P, x, y
+	}
+
+	null := testP256.Point().Null()
+	for i := 0; i < 20; i++ {
+		P, px, py := point()
+		Q, qx, qy := point()
+
+		sx, sy := c.Add(px, py, qx, qy)
+		S := testP256.Point().Add(P, Q)
+		if x, y := affine(S); x.Cmp(sx) != 0 || y.Cmp(sy) != 0 {
+			t.Fatal("wrong sum")
+		}
+		dx, dy := c.Double(px, py)
+		D := testP256.Point().Add(P, P)
+		if x, y := affine(D); x.Cmp(dx) != 0 || y.Cmp(dy) != 0 {
+			t.Fatal("wrong double")
+		}
+		if !testP256.Point().Sub(S, Q).Equal(P) || P.Equal(Q) {
+			t.Fatal("wrong difference")
+		}
+		if !testP256.Point().Add(P, testP256.Point().Neg(P)).Equal(null) ||
+			!testP256.Point().Add(P, null).Equal(P) || P.Equal(null) {
+			t.Fatal("wrong neutral element")
+		}
+
+		s := testP256.Scalar().Pick(rand)
+		mx, my := c.ScalarMult(sx, sy, s.(*mod.Int).V.Bytes())
+		M := testP256.Point().Mul(s, S)
+		if x, y := affine(M); x.Cmp(mx) != 0 || y.Cmp(my) != 0 {
+			t.Fatal("wrong product")
+		}
+
+		b, _ := S.MarshalBinary()
+		if !bytes.Equal(b, elliptic.Marshal(c, sx, sy)) {
+			t.Fatal("wrong encoding")
+		}
+		U := testP256.Point()
+		if err := U.UnmarshalBinary(b); err != nil || !U.Equal(S) {
+			t.Fatal("decoding failed:", err)
+		}
+		b[64] ^= 1
+		if err := U.UnmarshalBinary(b); err == nil {
+			t.Fatal("decoded a point off the curve")
+		}
+	}
+}
+
+func TestResidueExp(t *testing.T) {
+	g := &testQR512.ResidueGroup
+	rand := random.New()
+	one := g.Scalar().One()
+	scalars := []kyber.Scalar{g.Scalar().Zero(), one, g.Scalar().Neg(one)}
+	for i := 0; i < 5; i++ {
+		scalars = append(scalars, g.Scalar().Pick(rand))
+	}
+	points := make([]kyber.Point, len(scalars))
+	for i := range points {
+		points[i] = g.Point().Pick(rand)
+	}
+
+	P := points[0].Clone()
+	P.(kyber.Precomputable).Precompute()
+	for _, s := range scalars {
+		e := &s.(*mod.Int).V
+		want := new(big.Int).Exp(g.G, e, g.P)
+		if got := g.Point().Mul(s, nil).(*residuePoint); got.Int.Cmp(want) != 0 {
+			t.Fatal("wrong power of the generator")
+		}
+		want.Exp(&points[0].(*residuePoint).Int, e, g.P)
+		if got := g.Point().Mul(s, P).(*residuePoint); got.Int.Cmp(want) != 0 {
+			t.Fatal("wrong power of a precomputed point")
+		}
+	}
+
+	want := g.Point().Null()
+	for i := range points {
+		want.Add(want, g.Point().Mul(scalars[i], points[i]))
+	}
+	got := g.Point().(kyber.MultiScalarMultiplier).MultiScalarMul(scalars, points)
+	if !got.Equal(want) {
+		t.Fatal("wrong multi-exponentiation")
+	}
+}
+
 var benchP256 = test.NewGroupBench(testP256)
 
 func BenchmarkScalarAdd(b *testing.B)    { benchP256.ScalarAdd(b.N) }
@@ -46,3 +236,23 @@ func BenchmarkPointBaseMul(b *testing.B) { benchP256.PointBaseMul(b.N) }
 func BenchmarkPointPick(b *testing.B)    { benchP256.PointPick(b.N) }
 func BenchmarkPointEncode(b *testing.B)  { benchP256.PointEncode(b.N) }
 func BenchmarkPointDecode(b *testing.B)  { benchP256.PointDecode(b.N) }
+
+var benchQR512 = test.NewGroupBench(testQR512)
+
+func BenchmarkQR512PointMul(b *testing.B)     { benchQR512.PointMul(b.N) }
+func BenchmarkQR512PointBaseMul(b *testing.B) { benchQR512.PointBaseMul(b.N) }
+
+func BenchmarkQR512MultiScalarMul10(b *testing.B) {
+	rand := random.New()
+	scalars := make([]kyber.Scalar, 10)
+	points := make([]kyber.Point, 10)
+	for i := range points {
+		scalars[i] = testQR512.Scalar().Pick(rand)
+		points[i] = testQR512.Point().Pick(rand)
+	}
+	P := testQR512.Point().(kyber.MultiScalarMultiplier)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		P.MultiScalarMul(scalars, points)
+	}
+}
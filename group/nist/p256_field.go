@@ -0,0 +1,239 @@
+// +build vartime
+
+package nist
+
+import (
+	"math/big"
+	"math/bits"
+)
+
+// p256Element is an element of the P-256 base field GF(p), with
+// p = 2^256 - 2^224 + 2^192 + 2^96 - 1, in Montgomery form: it holds x*R mod p
+// for R = 2^256, as four 64-bit limbs, least significant first.
+// Elements are always fully reduced, and all operations run in constant time.
+type p256Element [4]uint64
+
+var p256P = p256Element{
+	0xffffffffffffffff, 0x00000000ffffffff,
+	0x0000000000000000, 0xffffffff00000001,
+}
+
+// p256One is 1 in Montgomery form, i.e. R mod p.
+var p256One = p256Element{
+	0x0000000000000001, 0xffffffff00000000,
+	0xffffffffffffffff, 0x00000000fffffffe,
+}
+
+// p256RR is R^2 mod p, which converts into Montgomery form.
+var p256RR = p256Element{
+	0x0000000000000003, 0xfffffffbffffffff,
+	0xfffffffffffffffe, 0x00000004fffffffd,
+}
+
+// p256Select sets z = a if c == 1 and z = b if c == 0.
+func p256Select(z, a, b *p256Element, c uint64) {
+	mask := -c
+	for i := range z {
+		z[i] = b[i] ^ (mask & (a[i] ^ b[i]))
+	}
+}
+
+// p256ReduceOnce sets z = r + top*2^256 mod p, for a value below 2p.
+func p256ReduceOnce(z, r *p256Element, top uint64) {
+	var d p256Element
+	var b uint64
+	d[0], b = bits.Sub64(r[0], p256P[0], 0)
+	d[1], b = bits.Sub64(r[1], p256P[1], b)
+	d[2], b = bits.Sub64(r[2], p256P[2], b)
+	d[3], b = bits.Sub64(r[3], p256P[3], b)
+	_, b = bits.Sub64(top, 0, b)
+	// the subtraction borrows iff the value was already below p
+	p256Select(z, r, &d, b)
+}
+
+// p256Add sets z = x + y.
+func p256Add(z, x, y *p256Element) {
+	var r p256Element
+	var c uint64
+	r[0], c = bits.Add64(x[0], y[0], 0)
+	r[1], c = bits.Add64(x[1], y[1], c)
+	r[2], c = bits.Add64(x[2], y[2], c)
+	r[3], c = bits.Add64(x[3], y[3], c)
+	p256ReduceOnce(z, &r, c)
+}
+
+// p256Sub sets z = x - y.
+func p256Sub(z, x, y *p256Element) {
+	var r p256Element
+	var b, c uint64
+	r[0], b = bits.Sub64(x[0], y[0], 0)
+	r[1], b = bits.Sub64(x[1], y[1], b)
+	r[2], b = bits.Sub64(x[2], y[2], b)
+	r[3], b = bits.Sub64(x[3], y[3], b)
+
+	// add p back if the difference is negative
+	mask := -b
+	r[0], c = bits.Add64(r[0], p256P[0]&mask, 0)
+	r[1], c = bits.Add64(r[1], p256P[1]&mask, c)
+	r[2], c = bits.Add64(r[2], p256P[2]&mask, c)
+	r[3], _ = bits.Add64(r[3], p256P[3]&mask, c)
+	*z = r
+}
+
+// p256Neg sets z = -x.
+func p256Neg(z, x *p256Element) {
+	var zero p256Element
+	p256Sub(z, &zero, x)
+}
+
+// p256Mul sets z = x*y/R mod p, i.e. the product in Montgomery form.
+func p256Mul(z, x, y *p256Element) {
+	var t [8]uint64
+	var hi, lo, c uint64
+	for i := 0; i < 4; i++ {
+		c = 0
+		for j := 0; j < 4; j++ {
+			hi, lo = bits.Mul64(x[i], y[j])
+			var cc uint64
+			lo, cc = bits.Add64(lo, t[i+j], 0)
+			hi += cc
+			lo, cc = bits.Add64(lo, c, 0)
+			hi += cc
+			t[i+j], c = lo, hi
+		}
+		t[i+4] = c
+	}
+
+	// Montgomery reduction: -1/p mod 2^64 is 1, so each step adds t[i]*p,
+	// clearing limb i. top is the carry into limb i+4.
+	var top uint64
+	for i := 0; i < 4; i++ {
+		m := t[i]
+		c = 0
+		for j := 0; j < 4; j++ {
+			hi, lo = bits.Mul64(m, p256P[j])
+			var cc uint64
+			lo, cc = bits.Add64(lo, t[i+j], 0)
+			hi += cc
+			lo, cc = bits.Add64(lo, c, 0)
+			hi += cc
+			t[i+j], c = lo, hi
+		}
+		t[i+4], top = bits.Add64(t[i+4], c, top)
+	}
+
+	// x*y + m*p < 2*R*p, so the quotient by R is below 2p.
+	r := p256Element{t[4], t[5], t[6], t[7]}
+	p256ReduceOnce(z, &r, top)
+}
+
+// p256Sqr sets z = x^(2^n) in Montgomery form, for n >= 1.
+func p256Sqr(z, x *p256Element, n int) {
+	p256Mul(z, x, x)
+	for i := 1; i < n; i++ {
+		p256Mul(z, z, z)
+	}
+}
+
+// p256Invert sets z = 1/x, and zero if x is zero, by raising x to the
+// power p-2 with the following addition chain, found with
+// github.com/mmcloughlin/addchain:
+//
+//	_10     = 2*1
+//	_11     = 1 + _10
+//	_110    = 2*_11
+//	_111    = 1 + _110
+//	_111000 = _111 << 3
+//	_111111 = _111 + _111000
+//	x12     = _111111 << 6 + _111111
+//	x15     = x12 << 3 + _111
+//	x16     = 2*x15 + 1
+//	x32     = x16 << 16 + x16
+//	i53     = x32 << 15
+//	x47     = x15 + i53
+//	i263    = ((i53 << 17 + 1) << 143 + x47) << 47
+//	return    (x47 + i263) << 2 + 1
+func p256Invert(z, x *p256Element) {
+	var _111, _111111, x15, x16, x47, t, i53 p256Element
+
+	p256Sqr(&t, x, 1)
+	p256Mul(&t, x, &t) // _11
+	p256Sqr(&t, &t, 1)
+	p256Mul(&_111, x, &t)
+	p256Sqr(&t, &_111, 3)
+	p256Mul(&_111111, &_111, &t)
+	p256Sqr(&t, &_111111, 6)
+	p256Mul(&t, &_111111, &t) // x12
+	p256Sqr(&t, &t, 3)
+	p256Mul(&x15, &_111, &t)
+	p256Sqr(&t, &x15, 1)
+	p256Mul(&x16, x, &t)
+	p256Sqr(&t, &x16, 16)
+	p256Mul(&t, &x16, &t) // x32
+	p256Sqr(&i53, &t, 15)
+	p256Mul(&x47, &x15, &i53)
+	p256Sqr(&t, &i53, 17)
+	p256Mul(&t, x, &t)
+	p256Sqr(&t, &t, 143)
+	p256Mul(&t, &x47, &t)
+	p256Sqr(&t, &t, 47) // i263
+	p256Mul(&t, &x47, &t)
+	p256Sqr(&t, &t, 2)
+	p256Mul(z, x, &t)
+}
+
+// p256IsZero returns 1 if x is zero and 0 otherwise.
+func p256IsZero(x *p256Element) uint64 {
+	v := x[0] | x[1] | x[2] | x[3]
+	return 1 ^ (v|-v)>>63
+}
+
+// p256Equal returns 1 if x == y and 0 otherwise.
+func p256Equal(x, y *p256Element) uint64 {
+	var d p256Element
+	for i := range d {
+		d[i] = x[i] ^ y[i]
+	}
+	return p256IsZero(&d)
+}
+
+// p256FromBytes sets z to the 32-byte big-endian value b, which it converts
+// to Montgomery form. It returns false if b is not below p.
+func p256FromBytes(z *p256Element, b []byte) bool {
+	var r p256Element
+	for i := range r {
+		k := 24 - 8*i
+		r[i] = uint64(b[k])<<56 | uint64(b[k+1])<<48 |
+			uint64(b[k+2])<<40 | uint64(b[k+3])<<32 |
+			uint64(b[k+4])<<24 | uint64(b[k+5])<<16 |
+			uint64(b[k+6])<<8 | uint64(b[k+7])
+	}
+	var bw uint64
+	_, bw = bits.Sub64(r[0], p256P[0], 0)
+	_, bw = bits.Sub64(r[1], p256P[1], bw)
+	_, bw = bits.Sub64(r[2], p256P[2], bw)
+	_, bw = bits.Sub64(r[3], p256P[3], bw)
+	p256Mul(z, &r, &p256RR)
+	return bw == 1
+}
+
+// p256ToBytes writes the canonical 32-byte big-endian encoding of x to b.
+func p256ToBytes(b []byte, x *p256Element) {
+	var r p256Element
+	p256Mul(&r, x, &p256Element{1}) // out of Montgomery form
+	for i := range r {
+		k := 24 - 8*i
+		for j := 0; j < 8; j++ {
+			b[k+j] = byte(r[i] >> (56 - 8*uint(j)))
+		}
+	}
+}
+
+// p256FromBig returns the element v, which must lie in [0, p).
+// It is only meant for public constants.
+func p256FromBig(v *big.Int) p256Element {
+	var b [32]byte
+	var z p256Element
+	p256FromBytes(&z, v.FillBytes(b[:]))
+	return z
+}
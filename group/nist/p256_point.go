@@ -0,0 +1,293 @@
+// +build vartime
+
+package nist
+
+import (
+	"crypto/cipher"
+	"crypto/elliptic"
+	"errors"
+	"io"
+	"math/big"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/group/internal/marshalling"
+	"github.com/dedis/kyber/group/mod"
+)
+
+// p256Point is a point on the P-256 curve in homogeneous projective
+// coordinates (X:Y:Z) over Montgomery-form field elements, standing for the
+// affine point (X/Z, Y/Z); the point at infinity is (0:1:0).
+// Additions use the complete formulas for a = -3 from Renes, Costello and
+// Batina, "Complete addition formulas for prime order elliptic curves",
+// https://eprint.iacr.org/2015/1060, which have no exceptional cases and
+// need no inversion. Affine coordinates are only computed for encoding and
+// for the scalar multiplication of Go's constant time P-256 implementation.
+type p256Point struct {
+	x, y, z p256Element
+	c       *curve
+}
+
+var (
+	p256B = p256FromBig(elliptic.P256().Params().B)
+	p256G = p256Point{
+		x: p256FromBig(elliptic.P256().Params().Gx),
+		y: p256FromBig(elliptic.P256().Params().Gy),
+		z: p256One,
+	}
+)
+
+// Point creates a new point on P-256, set to the point at infinity. The zero
+// value (0:0:0) is not a point, and would compare equal to any point.
+func (curve *p256) Point() kyber.Point {
+	return &p256Point{y: p256One, c: &curve.curve}
+}
+
+func (p *p256Point) String() string {
+	return p.curvePoint().String()
+}
+
+func (p *p256Point) Equal(p2 kyber.Point) bool {
+	q := p2.(*p256Point)
+
+	// (X1:Y1:Z1) == (X2:Y2:Z2) iff X1*Z2 == X2*Z1 and Y1*Z2 == Y2*Z1
+	var a, b, c, d p256Element
+	p256Mul(&a, &p.x, &q.z)
+	p256Mul(&b, &q.x, &p.z)
+	p256Mul(&c, &p.y, &q.z)
+	p256Mul(&d, &q.y, &p.z)
+	return p256Equal(&a, &b)&p256Equal(&c, &d) == 1
+}
+
+func (p *p256Point) Null() kyber.Point {
+	p.x = p256Element{}
+	p.y = p256One
+	p.z = p256Element{}
+	return p
+}
+
+func (p *p256Point) Base() kyber.Point {
+	p.x, p.y, p.z = p256G.x, p256G.y, p256G.z
+	return p
+}
+
+func (p *p256Point) EmbedLen() int {
+	return p.c.Point().EmbedLen()
+}
+
+func (p *p256Point) Pick(rand cipher.Stream) kyber.Point {
+	return p.Embed(nil, rand)
+}
+
+func (p *p256Point) Embed(data []byte, rand cipher.Stream) kyber.Point {
+	q := p.c.Point().Embed(data, rand).(*curvePoint)
+	p.setAffine(q.x, q.y)
+	return p
+}
+
+func (p *p256Point) Data() ([]byte, error) {
+	return p.curvePoint().Data()
+}
+
+func (p *p256Point) Add(a, b kyber.Point) kyber.Point {
+	p.add(a.(*p256Point), b.(*p256Point))
+	return p
+}
+
+func (p *p256Point) Sub(a, b kyber.Point) kyber.Point {
+	var nb p256Point
+	cb := b.(*p256Point)
+	nb.x, nb.z = cb.x, cb.z
+	p256Neg(&nb.y, &cb.y)
+	p.add(a.(*p256Point), &nb)
+	return p
+}
+
+func (p *p256Point) Neg(a kyber.Point) kyber.Point {
+	ca := a.(*p256Point)
+	p.x, p.z = ca.x, ca.z
+	p256Neg(&p.y, &ca.y)
+	return p
+}
+
+// Mul multiplies b by s with the constant time scalar multiplication of
+// crypto/elliptic, which is implemented in assembly on some platforms.
+func (p *p256Point) Mul(s kyber.Scalar, b kyber.Point) kyber.Point {
+	var k [32]byte
+	s.(*mod.Int).V.FillBytes(k[:])
+
+	var x, y *big.Int
+	if b == nil {
+		x, y = p.c.ScalarBaseMult(k[:])
+	} else {
+		var buf [64]byte
+		b.(*p256Point).affine(buf[:32], buf[32:])
+		x = new(big.Int).SetBytes(buf[:32])
+		y = new(big.Int).SetBytes(buf[32:])
+		x, y = p.c.ScalarMult(x, y, k[:])
+	}
+	p.setAffine(x, y)
+	return p
+}
+
+func (p *p256Point) MarshalSize() int {
+	return p.c.PointLen()
+}
+
+func (p *p256Point) MarshalBinary() ([]byte, error) {
+	return p.AppendBinary(make([]byte, 0, 65))
+}
+
+func (p *p256Point) AppendBinary(b []byte) ([]byte, error) {
+	n := len(b)
+	b = append(b, make([]byte, 65)...)
+	b[n] = 4 // uncompressed ANSI X9.62 representation
+	p.affine(b[n+1:n+33], b[n+33:])
+	return b, nil
+}
+
+func (p *p256Point) UnmarshalBinary(buf []byte) error {
+	if len(buf) != 65 {
+		return errors.New("invalid elliptic curve point")
+	}
+	// As for curvePoint, all-zero coordinates encode the point
+	// at infinity.
+	var c byte
+	for _, b := range buf[1:] {
+		c |= b
+	}
+	if c == 0 {
+		p.Null()
+		return nil
+	}
+
+	var x, y p256Element
+	if buf[0] != 4 || !p256FromBytes(&x, buf[1:33]) ||
+		!p256FromBytes(&y, buf[33:]) || !p256OnCurve(&x, &y) {
+		return errors.New("invalid elliptic curve point")
+	}
+	p.x, p.y, p.z = x, y, p256One
+	return nil
+}
+
+func (p *p256Point) MarshalTo(w io.Writer) (int, error) {
+	return marshalling.PointMarshalTo(p, w)
+}
+
+func (p *p256Point) UnmarshalFrom(r io.Reader) (int, error) {
+	return marshalling.PointUnmarshalFrom(p, r)
+}
+
+func (p *p256Point) Set(P kyber.Point) kyber.Point {
+	q := P.(*p256Point)
+	p.x, p.y, p.z = q.x, q.y, q.z
+	return p
+}
+
+func (p *p256Point) Clone() kyber.Point {
+	q := *p
+	return &q
+}
+
+// affine writes the big-endian affine coordinates of p to x and y,
+// or zeros if p is the point at infinity.
+func (p *p256Point) affine(x, y []byte) {
+	var zinv, t p256Element
+	if p.z == p256One {
+		zinv = p256One
+	} else {
+		p256Invert(&zinv, &p.z) // zero at infinity
+	}
+	p256Mul(&t, &p.x, &zinv)
+	p256ToBytes(x, &t)
+	p256Mul(&t, &p.y, &zinv)
+	p256ToBytes(y, &t)
+}
+
+// setAffine sets p to the affine point (x, y), using the crypto/elliptic
+// convention that (0, 0) stands for the point at infinity.
+func (p *p256Point) setAffine(x, y *big.Int) {
+	if x.Sign() == 0 && y.Sign() == 0 {
+		p.Null()
+		return
+	}
+	p.x = p256FromBig(x)
+	p.y = p256FromBig(y)
+	p.z = p256One
+}
+
+// curvePoint returns p as a generic curvePoint, for the big.Int based
+// operations shared with other curves.
+func (p *p256Point) curvePoint() *curvePoint {
+	var buf [64]byte
+	p.affine(buf[:32], buf[32:])
+	return &curvePoint{
+		x: new(big.Int).SetBytes(buf[:32]),
+		y: new(big.Int).SetBytes(buf[32:]),
+		c: p.c,
+	}
+}
+
+// p256OnCurve returns whether y^2 = x^3 - 3x + b.
+func p256OnCurve(x, y *p256Element) bool {
+	var l, r, t p256Element
+	p256Mul(&l, y, y)
+	p256Mul(&r, x, x)
+	p256Mul(&r, &r, x)
+	p256Add(&t, x, x)
+	p256Add(&t, &t, x)
+	p256Sub(&r, &r, &t)
+	p256Add(&r, &r, &p256B)
+	return p256Equal(&l, &r) == 1
+}
+
+// add sets p = a + b, following algorithm 4 of the paper.
+// The arguments may alias each other.
+func (p *p256Point) add(a, b *p256Point) {
+	var t0, t1, t2, t3, t4, x3, y3, z3 p256Element
+
+	p256Mul(&t0, &a.x, &b.x)  // t0 := X1 * X2
+	p256Mul(&t1, &a.y, &b.y)  // t1 := Y1 * Y2
+	p256Mul(&t2, &a.z, &b.z)  // t2 := Z1 * Z2
+	p256Add(&t3, &a.x, &a.y)  // t3 := X1 + Y1
+	p256Add(&t4, &b.x, &b.y)  // t4 := X2 + Y2
+	p256Mul(&t3, &t3, &t4)    // t3 := t3 * t4
+	p256Add(&t4, &t0, &t1)    // t4 := t0 + t1
+	p256Sub(&t3, &t3, &t4)    // t3 := t3 - t4
+	p256Add(&t4, &a.y, &a.z)  // t4 := Y1 + Z1
+	p256Add(&x3, &b.y, &b.z)  // X3 := Y2 + Z2
+	p256Mul(&t4, &t4, &x3)    // t4 := t4 * X3
+	p256Add(&x3, &t1, &t2)    // X3 := t1 + t2
+	p256Sub(&t4, &t4, &x3)    // t4 := t4 - X3
+	p256Add(&x3, &a.x, &a.z)  // X3 := X1 + Z1
+	p256Add(&y3, &b.x, &b.z)  // Y3 := X2 + Z2
+	p256Mul(&x3, &x3, &y3)    // X3 := X3 * Y3
+	p256Add(&y3, &t0, &t2)    // Y3 := t0 + t2
+	p256Sub(&y3, &x3, &y3)    // Y3 := X3 - Y3
+	p256Mul(&z3, &p256B, &t2) // Z3 := b * t2
+	p256Sub(&x3, &y3, &z3)    // X3 := Y3 - Z3
+	p256Add(&z3, &x3, &x3)    // Z3 := X3 + X3
+	p256Add(&x3, &x3, &z3)    // X3 := X3 + Z3
+	p256Sub(&z3, &t1, &x3)    // Z3 := t1 - X3
+	p256Add(&x3, &t1, &x3)    // X3 := t1 + X3
+	p256Mul(&y3, &p256B, &y3) // Y3 := b * Y3
+	p256Add(&t1, &t2, &t2)    // t1 := t2 + t2
+	p256Add(&t2, &t1, &t2)    // t2 := t1 + t2
+	p256Sub(&y3, &y3, &t2)    // Y3 := Y3 - t2
+	p256Sub(&y3, &y3, &t0)    // Y3 := Y3 - t0
+	p256Add(&t1, &y3, &y3)    // t1 := Y3 + Y3
+	p256Add(&y3, &t1, &y3)    // Y3 := t1 + Y3
+	p256Add(&t1, &t0, &t0)    // t1 := t0 + t0
+	p256Add(&t0, &t1, &t0)    // t0 := t1 + t0
+	p256Sub(&t0, &t0, &t2)    // t0 := t0 - t2
+	p256Mul(&t1, &t4, &y3)    // t1 := t4 * Y3
+	p256Mul(&t2, &t0, &y3)    // t2 := t0 * Y3
+	p256Mul(&y3, &x3, &z3)    // Y3 := X3 * Z3
+	p256Add(&y3, &y3, &t2)    // Y3 := Y3 + t2
+	p256Mul(&x3, &t3, &x3)    // X3 := t3 * X3
+	p256Sub(&x3, &x3, &t1)    // X3 := X3 - t1
+	p256Mul(&z3, &t4, &z3)    // Z3 := t4 * Z3
+	p256Mul(&t1, &t3, &t0)    // t1 := t3 * t0
+	p256Add(&z3, &z3, &t1)    // Z3 := Z3 + t1
+
+	p.x, p.y, p.z = x3, y3, z3
+}
@@ -22,7 +22,8 @@ var two = big.NewInt(2)
 
 type residuePoint struct {
 	big.Int
-	g *ResidueGroup
+	g     *ResidueGroup
+	table *residueTable // set by Precompute, only valid while it matches Int
 }
 
 // Steal value from DSA, which uses recommendation from FIPS 186-3
@@ -49,14 +50,31 @@ func (p *residuePoint) Base() kyber.Point {
 	return p
 }
 
+// Set and Clone copy the value of the big.Int rather than the struct, which
+// would share its limbs with the original.
 func (p *residuePoint) Set(p2 kyber.Point) kyber.Point {
 	p.g = p2.(*residuePoint).g
-	p.Int = p2.(*residuePoint).Int
+	p.Int.Set(&p2.(*residuePoint).Int)
+	p.table = p2.(*residuePoint).table
 	return p
 }
 
 func (p *residuePoint) Clone() kyber.Point {
-	return &residuePoint{g: p.g, Int: p.Int}
+	p2 := &residuePoint{g: p.g, table: p.table}
+	p2.Int.Set(&p.Int)
+	return p2
+}
+
+// Precompute builds a table of ceil(n/w) powers of p, where n is the bit
+// length of Q and w the window chosen by residueWindow, so that later
+// exponentiations of p need no squarings, which makes them several times
+// faster. For a 2048-bit P and Q, the table takes about 90KB.
+// The table is shared with copies of p made by Set and Clone, and is
+// ignored once p is changed to another value.
+func (p *residuePoint) Precompute() {
+	if p.table == nil || !p.table.matches(&p.Int) {
+		p.table = newResidueTable(&p.Int, p.g.P, p.g.Q.BitLen())
+	}
 }
 
 func (p *residuePoint) Valid() bool {
@@ -131,16 +149,54 @@ func (p *residuePoint) Neg(a kyber.Point) kyber.Point {
 }
 
 func (p *residuePoint) Mul(s kyber.Scalar, b kyber.Point) kyber.Point {
-	if b == nil {
-		return p.Base().Mul(s, p)
-	}
 	// to protect against golang/go#22830
 	var tmp big.Int
-	tmp.Exp(&b.(*residuePoint).Int, &s.(*mod.Int).V, p.g.P)
+	p.g.exp(&tmp, &s.(*mod.Int).V, b)
 	p.Int = tmp
 	return p
 }
 
+// MultiScalarMul sets p to the product of points[i]^scalars[i], where a nil
+// point stands for the generator G. Precomputed points and G use their
+// fixed-base tables, the others share their squarings.
+func (p *residuePoint) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("mismatched number of scalars and points")
+	}
+	P := p.g.P
+	acc := new(big.Int).SetInt64(1)
+	var tmp big.Int
+	var bases, exps []*big.Int
+	n := 0
+	for i := range points {
+		e := &scalars[i].(*mod.Int).V
+		if b, tab := p.g.base(points[i]); tab != nil {
+			tab.exp(&tmp, e, P)
+			acc.Mul(acc, &tmp)
+			acc.Mod(acc, P)
+		} else {
+			bases = append(bases, b)
+			exps = append(exps, e)
+			if e.BitLen() > n {
+				n = e.BitLen()
+			}
+		}
+	}
+	if residueUseStraus(len(bases), n, P.BitLen()) {
+		residueStraus(&tmp, bases, exps, n, P)
+		acc.Mul(acc, &tmp)
+		acc.Mod(acc, P)
+	} else {
+		for i := range bases {
+			tmp.Exp(bases[i], exps[i], P)
+			acc.Mul(acc, &tmp)
+			acc.Mod(acc, P)
+		}
+	}
+	p.Int = *acc
+	return p
+}
+
 func (p *residuePoint) MarshalSize() int {
 	return (p.g.P.BitLen() + 7) / 8
 }
@@ -153,6 +209,13 @@ func (p *residuePoint) MarshalBinary() ([]byte, error) {
 	return b, nil
 }
 
+func (p *residuePoint) AppendBinary(b []byte) ([]byte, error) {
+	n := len(b)
+	b = append(b, make([]byte, p.MarshalSize())...)
+	p.Int.FillBytes(b[n:])
+	return b, nil
+}
+
 func (p *residuePoint) UnmarshalBinary(data []byte) error {
 	p.Int.SetBytes(data)
 	if !p.Valid() {
@@ -197,6 +260,8 @@ ONLY on quadratic residue groups in which R=2.
 type ResidueGroup struct {
 	dsa.Parameters
 	R *big.Int
+
+	gTable *residueTable // fixed-base table for G, set by SetParams
 }
 
 func (g *ResidueGroup) String() string {
@@ -225,6 +290,31 @@ func (g *ResidueGroup) Point() kyber.Point {
 	return p
 }
 
+// base returns the value of the point b, the generator G if b is nil,
+// along with its fixed-base table if it has a valid one.
+func (g *ResidueGroup) base(b kyber.Point) (*big.Int, *residueTable) {
+	if b == nil {
+		if g.gTable != nil && g.gTable.matches(g.G) {
+			return g.G, g.gTable
+		}
+		return g.G, nil
+	}
+	rb := b.(*residuePoint)
+	if rb.table != nil && rb.table.matches(&rb.Int) {
+		return &rb.Int, rb.table
+	}
+	return &rb.Int, nil
+}
+
+// exp sets z = b^e mod P, where a nil b stands for the generator G.
+func (g *ResidueGroup) exp(z, e *big.Int, b kyber.Point) {
+	if x, tab := g.base(b); tab != nil {
+		tab.exp(z, e, g.P)
+	} else {
+		z.Exp(x, e, g.P)
+	}
+}
+
 // Returns the order of this Residue group, namely the prime Q.
 func (g *ResidueGroup) Order() *big.Int {
 	return g.Q
@@ -265,6 +355,7 @@ func (g *ResidueGroup) SetParams(P, Q, R, G *big.Int) {
 	if !g.Valid() {
 		panic("SetParams: bad Residue group parameters")
 	}
+	g.gTable = newResidueTable(G, P, Q.BitLen())
 }
 
 // Initialize Residue group parameters for a quadratic residue group,
@@ -314,4 +405,5 @@ func (g *ResidueGroup) QuadraticResidueGroup(bitlen uint, rand cipher.Stream) {
 		h.Add(h, one)
 	}
 	println("g", g.G.String())
+	g.gTable = newResidueTable(g.G, g.P, g.Q.BitLen())
 }
@@ -0,0 +1,172 @@
+// +build vartime
+
+package nist
+
+import (
+	"math/big"
+)
+
+// Exponentiation helpers for residue groups. big.Int.Exp already uses
+// Montgomery multiplication internally, so the methods below only pay off
+// by doing fewer multiplications: a precomputed base needs no squarings
+// at all, and several bases raised at once share their squarings.
+// Like big.Int.Exp, they run in variable time.
+
+// residueWindow returns the window width w minimizing ceil(n/w) + 2^w,
+// the approximate number of multiplications of both methods below for
+// n-bit exponents.
+func residueWindow(n int) uint {
+	best, bestCost := uint(1), -1
+	for w := uint(1); w <= 12; w++ {
+		cost := (n+int(w)-1)/int(w) + 1<<w
+		if bestCost < 0 || cost < bestCost {
+			best, bestCost = w, cost
+		}
+	}
+	return best
+}
+
+// residueMul multiplies modulo P, reusing its buffers for the product and
+// the quotient to avoid the allocations of big.Int.Mod.
+type residueMul struct {
+	P    *big.Int
+	t, q big.Int
+}
+
+// mul sets z = x*y mod P; z may alias x or y.
+func (m *residueMul) mul(z, x, y *big.Int) {
+	m.t.Mul(x, y)
+	m.q.QuoRem(&m.t, m.P, z)
+}
+
+// residueDigit returns the w-bit digit of e starting at bit position pos.
+func residueDigit(e *big.Int, pos, w uint) uint {
+	d := uint(0)
+	for k := w; k > 0; k-- {
+		d = d<<1 | e.Bit(int(pos+k-1))
+	}
+	return d
+}
+
+// residueTable holds the powers base^(2^(w*i)) of a fixed base, for Yao's
+// fixed-base exponentiation method as described by Brickell, Gordon,
+// McCurley and Wilson, "Fast exponentiation with precomputation" (1992).
+// Raising base to an n-bit exponent then takes about n/w + 2^w
+// multiplications instead of n squarings. The table only applies while
+// the base still equals base, the value it was computed from.
+type residueTable struct {
+	base   big.Int
+	w      uint
+	powers []big.Int
+}
+
+// newResidueTable precomputes the powers of b modulo P needed for
+// exponents of up to n bits.
+func newResidueTable(b, P *big.Int, n int) *residueTable {
+	t := &residueTable{w: residueWindow(n)}
+	t.base.Set(b)
+	t.powers = make([]big.Int, (n+int(t.w)-1)/int(t.w))
+	t.powers[0].Set(b)
+	m := residueMul{P: P}
+	for i := 1; i < len(t.powers); i++ {
+		x := &t.powers[i]
+		x.Set(&t.powers[i-1])
+		for k := uint(0); k < t.w; k++ {
+			m.mul(x, x, x)
+		}
+	}
+	return t
+}
+
+// matches returns whether the table was computed from the value b.
+func (t *residueTable) matches(b *big.Int) bool {
+	return t.base.Cmp(b) == 0
+}
+
+// exp sets z = base^e mod P, for a non-negative exponent e.
+func (t *residueTable) exp(z, e, P *big.Int) {
+	if e.BitLen() > int(t.w)*len(t.powers) {
+		z.Exp(&t.base, e, P)
+		return
+	}
+
+	digits := make([]uint, len(t.powers))
+	for i := range digits {
+		digits[i] = residueDigit(e, uint(i)*t.w, t.w)
+	}
+
+	// With B the product of the powers whose digit is at least d,
+	// the product of all B over d = 2^w-1, ..., 1 is base^e.
+	m := residueMul{P: P}
+	A, B := new(big.Int).SetInt64(1), new(big.Int).SetInt64(1)
+	started := false
+	for d := uint(1)<<t.w - 1; d > 0; d-- {
+		for i, di := range digits {
+			if di != d {
+				continue
+			}
+			if started {
+				m.mul(B, B, &t.powers[i])
+			} else {
+				B.Set(&t.powers[i])
+				started = true
+			}
+		}
+		if started {
+			m.mul(A, A, B)
+		}
+	}
+	z.Set(A)
+}
+
+// residueUseStraus returns whether interleaving k exponentiations to n-bit
+// exponents modulo a prime of pbits bits beats k calls to big.Int.Exp.
+// Counted in multiplications modulo P, Straus' method costs about
+// n + k*(2^w + n/w), while big.Int.Exp, whose Montgomery multiplications
+// are cheaper, costs about r*n per exponent, with r measured at about 0.4
+// for 512-bit moduli, 0.5 for 1024 bits and 0.6 from 2048 bits on.
+func residueUseStraus(k, n, pbits int) bool {
+	r := 0.6
+	switch {
+	case pbits < 1024:
+		r = 0.4
+	case pbits < 2048:
+		r = 0.5
+	}
+	w := residueWindow(n)
+	return float64(n+k*(1<<w+n/int(w))) < r*float64(k*n)
+}
+
+// residueStraus sets z = prod_i b[i]^e[i] mod P with Straus' method,
+// interleaving fixed windows of all exponents, which must have at most
+// n bits, so that the bases share their squarings.
+func residueStraus(z *big.Int, b, e []*big.Int, n int, P *big.Int) {
+	w := residueWindow(n)
+	m := residueMul{P: P}
+
+	// tables[i][d-1] = b[i]^d
+	tables := make([][]big.Int, len(b))
+	for i := range b {
+		tables[i] = make([]big.Int, 1<<w-1)
+		tables[i][0].Set(b[i])
+		for d := 1; d < len(tables[i]); d++ {
+			m.mul(&tables[i][d], &tables[i][d-1], b[i])
+		}
+	}
+
+	acc := new(big.Int).SetInt64(1)
+	for pos := (n + int(w) - 1) / int(w) * int(w); pos > 0; {
+		pos -= int(w)
+		if acc.BitLen() > 1 {
+			for k := uint(0); k < w; k++ {
+				m.mul(acc, acc, acc)
+			}
+		}
+		for i := range e {
+			if d := residueDigit(e[i], uint(pos), w); d != 0 {
+				m.mul(acc, acc, &tables[i][d-1])
+			}
+		}
+	}
+	z.Set(acc)
+}
@@ -0,0 +1,182 @@
+package trace
+
+import (
+	"crypto/cipher"
+	"io"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/util/msm"
+)
+
+// point is a traced kyber.Point, wrapping a point of the traced suite.
+type point struct {
+	p     kyber.Point
+	stats *Stats
+}
+
+// unwrapPoint returns the wrapped point of p if p is traced, p otherwise.
+func unwrapPoint(p kyber.Point) kyber.Point {
+	if tp, ok := p.(*point); ok {
+		return tp.p
+	}
+	return p
+}
+
+func (P *point) String() string {
+	return P.p.String()
+}
+
+func (P *point) MarshalSize() int {
+	return P.p.MarshalSize()
+}
+
+func (P *point) MarshalBinary() ([]byte, error) {
+	t := P.stats.begin()
+	b, err := P.p.MarshalBinary()
+	P.stats.end(PointEncode, 1, t)
+	return b, err
+}
+
+func (P *point) AppendBinary(b []byte) ([]byte, error) {
+	t := P.stats.begin()
+	b, err := P.p.AppendBinary(b)
+	P.stats.end(PointEncode, 1, t)
+	return b, err
+}
+
+func (P *point) UnmarshalBinary(b []byte) error {
+	t := P.stats.begin()
+	err := P.p.UnmarshalBinary(b)
+	P.stats.end(PointDecode, 1, t)
+	return err
+}
+
+func (P *point) MarshalTo(w io.Writer) (int, error) {
+	t := P.stats.begin()
+	n, err := P.p.MarshalTo(w)
+	P.stats.end(PointEncode, 1, t)
+	return n, err
+}
+
+func (P *point) UnmarshalFrom(r io.Reader) (int, error) {
+	t := P.stats.begin()
+	n, err := P.p.UnmarshalFrom(r)
+	P.stats.end(PointDecode, 1, t)
+	return n, err
+}
+
+func (P *point) Equal(P2 kyber.Point) bool {
+	t := P.stats.begin()
+	eq := P.p.Equal(unwrapPoint(P2))
+	P.stats.end(PointEqual, 1, t)
+	return eq
+}
+
+func (P *point) Null() kyber.Point {
+	P.p.Null()
+	return P
+}
+
+func (P *point) Base() kyber.Point {
+	P.p.Base()
+	return P
+}
+
+func (P *point) Pick(rand cipher.Stream) kyber.Point {
+	t := P.stats.begin()
+	P.p.Pick(rand)
+	P.stats.end(PointPick, 1, t)
+	return P
+}
+
+func (P *point) Set(P2 kyber.Point) kyber.Point {
+	P.p.Set(unwrapPoint(P2))
+	return P
+}
+
+func (P *point) Clone() kyber.Point {
+	return &point{P.p.Clone(), P.stats}
+}
+
+func (P *point) EmbedLen() int {
+	return P.p.EmbedLen()
+}
+
+func (P *point) Embed(data []byte, rand cipher.Stream) kyber.Point {
+	t := P.stats.begin()
+	P.p.Embed(data, rand)
+	P.stats.end(PointPick, 1, t)
+	return P
+}
+
+func (P *point) Data() ([]byte, error) {
+	return P.p.Data()
+}
+
+func (P *point) Add(P1, P2 kyber.Point) kyber.Point {
+	t := P.stats.begin()
+	P.p.Add(unwrapPoint(P1), unwrapPoint(P2))
+	P.stats.end(PointAdd, 1, t)
+	return P
+}
+
+func (P *point) Sub(P1, P2 kyber.Point) kyber.Point {
+	t := P.stats.begin()
+	P.p.Sub(unwrapPoint(P1), unwrapPoint(P2))
+	P.stats.end(PointAdd, 1, t)
+	return P
+}
+
+func (P *point) Neg(P1 kyber.Point) kyber.Point {
+	t := P.stats.begin()
+	P.p.Neg(unwrapPoint(P1))
+	P.stats.end(PointNeg, 1, t)
+	return P
+}
+
+func (P *point) Mul(s kyber.Scalar, P1 kyber.Point) kyber.Point {
+	op := PointMul
+	if P1 == nil {
+		op = PointBaseMul
+	} else {
+		P1 = unwrapPoint(P1)
+	}
+	t := P.stats.begin()
+	P.p.Mul(unwrapScalar(s), P1)
+	P.stats.end(op, 1, t)
+	return P
+}
+
+// MultiScalarMul computes the linear combination with the wrapped group's
+// multi-scalar multiplication if it has one, or with Mul and Add
+// otherwise; either way it is recorded as one PointMultiScalarMul.
+func (P *point) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	ss := make([]kyber.Scalar, len(scalars))
+	for i, s := range scalars {
+		ss[i] = unwrapScalar(s)
+	}
+	ps := make([]kyber.Point, len(points))
+	for i, p := range points {
+		if p != nil {
+			ps[i] = unwrapPoint(p)
+		}
+	}
+	t := P.stats.begin()
+	msm.Sum(P.p, ss, ps)
+	P.stats.end(PointMultiScalarMul, 1, t)
+	return P
+}
+
+// Precompute precomputes the wrapped point if its group supports it.
+func (P *point) Precompute() {
+	if pc, ok := P.p.(kyber.Precomputable); ok {
+		pc.Precompute()
+	}
+}
+
+// AllowVarTime forwards to the wrapped point if its group supports it.
+func (P *point) AllowVarTime(varTime bool) {
+	if vt, ok := P.p.(kyber.AllowsVarTime); ok {
+		vt.AllowVarTime(varTime)
+	}
+}
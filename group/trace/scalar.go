@@ -0,0 +1,149 @@
+package trace
+
+import (
+	"crypto/cipher"
+	"io"
+
+	"github.com/dedis/kyber"
+)
+
+// scalar is a traced kyber.Scalar, wrapping a scalar of the traced suite.
+type scalar struct {
+	s     kyber.Scalar
+	stats *Stats
+}
+
+// unwrapScalar returns the wrapped scalar of s if s is traced, s otherwise.
+func unwrapScalar(s kyber.Scalar) kyber.Scalar {
+	if ts, ok := s.(*scalar); ok {
+		return ts.s
+	}
+	return s
+}
+
+func (s *scalar) String() string {
+	return s.s.String()
+}
+
+func (s *scalar) MarshalSize() int {
+	return s.s.MarshalSize()
+}
+
+func (s *scalar) MarshalBinary() ([]byte, error) {
+	t := s.stats.begin()
+	b, err := s.s.MarshalBinary()
+	s.stats.end(ScalarEncode, 1, t)
+	return b, err
+}
+
+func (s *scalar) AppendBinary(b []byte) ([]byte, error) {
+	t := s.stats.begin()
+	b, err := s.s.AppendBinary(b)
+	s.stats.end(ScalarEncode, 1, t)
+	return b, err
+}
+
+func (s *scalar) UnmarshalBinary(b []byte) error {
+	t := s.stats.begin()
+	err := s.s.UnmarshalBinary(b)
+	s.stats.end(ScalarDecode, 1, t)
+	return err
+}
+
+func (s *scalar) MarshalTo(w io.Writer) (int, error) {
+	t := s.stats.begin()
+	n, err := s.s.MarshalTo(w)
+	s.stats.end(ScalarEncode, 1, t)
+	return n, err
+}
+
+func (s *scalar) UnmarshalFrom(r io.Reader) (int, error) {
+	t := s.stats.begin()
+	n, err := s.s.UnmarshalFrom(r)
+	s.stats.end(ScalarDecode, 1, t)
+	return n, err
+}
+
+func (s *scalar) Equal(s2 kyber.Scalar) bool {
+	return s.s.Equal(unwrapScalar(s2))
+}
+
+func (s *scalar) Set(a kyber.Scalar) kyber.Scalar {
+	s.s.Set(unwrapScalar(a))
+	return s
+}
+
+func (s *scalar) Clone() kyber.Scalar {
+	return &scalar{s.s.Clone(), s.stats}
+}
+
+func (s *scalar) SetInt64(v int64) kyber.Scalar {
+	s.s.SetInt64(v)
+	return s
+}
+
+func (s *scalar) Zero() kyber.Scalar {
+	s.s.Zero()
+	return s
+}
+
+func (s *scalar) One() kyber.Scalar {
+	s.s.One()
+	return s
+}
+
+func (s *scalar) Add(a, b kyber.Scalar) kyber.Scalar {
+	t := s.stats.begin()
+	s.s.Add(unwrapScalar(a), unwrapScalar(b))
+	s.stats.end(ScalarAdd, 1, t)
+	return s
+}
+
+func (s *scalar) Sub(a, b kyber.Scalar) kyber.Scalar {
+	t := s.stats.begin()
+	s.s.Sub(unwrapScalar(a), unwrapScalar(b))
+	s.stats.end(ScalarAdd, 1, t)
+	return s
+}
+
+func (s *scalar) Neg(a kyber.Scalar) kyber.Scalar {
+	t := s.stats.begin()
+	s.s.Neg(unwrapScalar(a))
+	s.stats.end(ScalarNeg, 1, t)
+	return s
+}
+
+func (s *scalar) Mul(a, b kyber.Scalar) kyber.Scalar {
+	t := s.stats.begin()
+	s.s.Mul(unwrapScalar(a), unwrapScalar(b))
+	s.stats.end(ScalarMul, 1, t)
+	return s
+}
+
+func (s *scalar) Div(a, b kyber.Scalar) kyber.Scalar {
+	t := s.stats.begin()
+	s.s.Div(unwrapScalar(a), unwrapScalar(b))
+	s.stats.end(ScalarInv, 1, t)
+	return s
+}
+
+func (s *scalar) Inv(a kyber.Scalar) kyber.Scalar {
+	t := s.stats.begin()
+	s.s.Inv(unwrapScalar(a))
+	s.stats.end(ScalarInv, 1, t)
+	return s
+}
+
+func (s *scalar) Pick(rand cipher.Stream) kyber.Scalar {
+	t := s.stats.begin()
+	s.s.Pick(rand)
+	s.stats.end(ScalarPick, 1, t)
+	return s
+}
+
+func (s *scalar) SetBytes(b []byte) kyber.Scalar {
+	t := s.stats.begin()
+	s.s.SetBytes(b)
+	s.stats.end(ScalarDecode, 1, t)
+	return s
+}
@@ -0,0 +1,234 @@
+package trace
+
+import (
+	"bytes"
+	"fmt"
+	"math/bits"
+	"sync/atomic"
+	"time"
+)
+
+// Op identifies a kind of operation recorded by Stats.
+type Op int
+
+// The recorded operations. The counts of the *Bytes operations are in
+// bytes rather than calls; their histograms still have one entry per call.
+const (
+	PointAdd            Op = iota // Add and Sub of points
+	PointNeg                      // negation of a point
+	PointMul                      // multiplication of an arbitrary point
+	PointBaseMul                  // multiplication of the standard base point
+	PointMultiScalarMul           // multi-scalar multiplication, per call
+	PointPick                     // Pick and Embed
+	PointEqual                    // equality tests
+	PointEncode                   // marshaling of a point
+	PointDecode                   // unmarshaling of a point
+	ScalarAdd                     // Add and Sub of scalars
+	ScalarNeg                     // negation of a scalar
+	ScalarMul                     // multiplication of scalars
+	ScalarInv                     // Inv and Div of scalars
+	ScalarPick                    // Pick
+	ScalarEncode                  // marshaling of a scalar
+	ScalarDecode                  // unmarshaling of a scalar, and SetBytes
+	XOFWriteBytes                 // bytes absorbed by XOFs
+	XOFReadBytes                  // bytes output by XOFs
+	RandomBytes                   // bytes output by random streams
+
+	// NumOps is the number of recorded operations.
+	NumOps
+)
+
+var opNames = [NumOps]string{
+	"PointAdd", "PointNeg", "PointMul", "PointBaseMul",
+	"PointMultiScalarMul", "PointPick", "PointEqual", "PointEncode",
+	"PointDecode", "ScalarAdd", "ScalarNeg", "ScalarMul", "ScalarInv",
+	"ScalarPick", "ScalarEncode", "ScalarDecode", "XOFWriteBytes",
+	"XOFReadBytes", "RandomBytes",
+}
+
+func (op Op) String() string {
+	if op < 0 || op >= NumOps {
+		return fmt.Sprintf("Op(%d)", int(op))
+	}
+	return opNames[op]
+}
+
+// Level selects what Stats records.
+type Level int32
+
+const (
+	// Off records nothing; the wrapped suite then only costs an
+	// indirection and an atomic load per operation.
+	Off Level = iota
+	// Counts records the number of operations.
+	Counts
+	// Latencies records the number of operations and their latencies,
+	// which costs two clock readings per operation.
+	Latencies
+)
+
+// HistBuckets is the number of buckets of the latency histograms. Bucket 0
+// counts the operations that took less than a nanosecond and bucket i > 0
+// those that took [2^(i-1), 2^i) nanoseconds, the last bucket also
+// counting any longer ones.
+const HistBuckets = 40
+
+// A Hook is called by Stats after every recorded operation, with the
+// count it added (1, or a number of bytes) and the latency, which is zero
+// below the Latencies level. It may be called from several goroutines at
+// once.
+type Hook func(op Op, n uint64, d time.Duration)
+
+type opStats struct {
+	count uint64
+	nanos uint64
+	hist  [HistBuckets]uint64
+}
+
+// Stats accumulates the operations of the suites returned by New. All its
+// methods are safe for concurrent use, and its String method makes it an
+// expvar.Var, e.g. for expvar.Publish("kyber", stats).
+type Stats struct {
+	ops   [NumOps]opStats // first, for 64-bit alignment on 32-bit platforms
+	level int32
+	hook  atomic.Value // Hook
+}
+
+// NewStats returns Stats recording at the given level.
+func NewStats(level Level) *Stats {
+	s := &Stats{}
+	s.SetLevel(level)
+	return s
+}
+
+// SetLevel changes what s records from now on.
+func (s *Stats) SetLevel(level Level) {
+	atomic.StoreInt32(&s.level, int32(level))
+}
+
+// SetHook installs a function called after each recorded operation;
+// nil removes it.
+func (s *Stats) SetHook(h Hook) {
+	s.hook.Store(h)
+}
+
+// begin returns the start time of an operation, or the zero time when
+// latencies are not recorded.
+func (s *Stats) begin() time.Time {
+	if Level(atomic.LoadInt32(&s.level)) < Latencies {
+		return time.Time{}
+	}
+	return time.Now()
+}
+
+// end records an operation started at t.
+func (s *Stats) end(op Op, n uint64, t time.Time) {
+	if Level(atomic.LoadInt32(&s.level)) == Off {
+		return
+	}
+	o := &s.ops[op]
+	atomic.AddUint64(&o.count, n)
+	var d time.Duration
+	if !t.IsZero() {
+		d = time.Since(t)
+		atomic.AddUint64(&o.nanos, uint64(d))
+		b := bits.Len64(uint64(d))
+		if b >= HistBuckets {
+			b = HistBuckets - 1
+		}
+		atomic.AddUint64(&o.hist[b], 1)
+	}
+	if h, _ := s.hook.Load().(Hook); h != nil {
+		h(op, n, d)
+	}
+}
+
+// Reset clears all the recorded operations.
+func (s *Stats) Reset() {
+	for i := range s.ops {
+		o := &s.ops[i]
+		atomic.StoreUint64(&o.count, 0)
+		atomic.StoreUint64(&o.nanos, 0)
+		for j := range o.hist {
+			atomic.StoreUint64(&o.hist[j], 0)
+		}
+	}
+}
+
+// Snapshot returns the operations recorded so far. Operations running
+// concurrently may be partially reflected.
+func (s *Stats) Snapshot() *Snapshot {
+	snap := &Snapshot{}
+	for i := range s.ops {
+		o := &s.ops[i]
+		snap.Counts[i] = atomic.LoadUint64(&o.count)
+		snap.Nanos[i] = atomic.LoadUint64(&o.nanos)
+		for j := range o.hist {
+			snap.Hist[i][j] = atomic.LoadUint64(&o.hist[j])
+		}
+	}
+	return snap
+}
+
+// String returns the current snapshot in JSON.
+func (s *Stats) String() string {
+	return s.Snapshot().String()
+}
+
+// Snapshot is a copy of the operations recorded by Stats, indexed by Op.
+type Snapshot struct {
+	Counts [NumOps]uint64
+	Nanos  [NumOps]uint64 // total latency, in nanoseconds
+	Hist   [NumOps][HistBuckets]uint64
+}
+
+// Sub returns the operations recorded in s but not in the earlier
+// snapshot prev, e.g. those of one phase of a protocol.
+func (s *Snapshot) Sub(prev *Snapshot) *Snapshot {
+	d := &Snapshot{}
+	for i := range s.Counts {
+		d.Counts[i] = s.Counts[i] - prev.Counts[i]
+		d.Nanos[i] = s.Nanos[i] - prev.Nanos[i]
+		for j := range s.Hist[i] {
+			d.Hist[i][j] = s.Hist[i][j] - prev.Hist[i][j]
+		}
+	}
+	return d
+}
+
+// String returns s in JSON, as an object mapping the name of each
+// recorded operation to its count and, if latencies were recorded, to its
+// total latency in nanoseconds and histogram.
+func (s *Snapshot) String() string {
+	var buf bytes.Buffer
+	buf.WriteByte('{')
+	first := true
+	for i := range s.Counts {
+		if s.Counts[i] == 0 {
+			continue
+		}
+		if !first {
+			buf.WriteByte(',')
+		}
+		first = false
+		fmt.Fprintf(&buf, "%q:{\"count\":%d", Op(i).String(), s.Counts[i])
+		if s.Nanos[i] != 0 {
+			// Trailing empty buckets are left out.
+			h := s.Hist[i][:]
+			for len(h) > 0 && h[len(h)-1] == 0 {
+				h = h[:len(h)-1]
+			}
+			fmt.Fprintf(&buf, ",\"ns\":%d,\"hist\":[", s.Nanos[i])
+			for j, c := range h {
+				if j > 0 {
+					buf.WriteByte(',')
+				}
+				fmt.Fprintf(&buf, "%d", c)
+			}
+			buf.WriteByte(']')
+		}
+		buf.WriteByte('}')
+	}
+	buf.WriteByte('}')
+	return buf.String()
+}
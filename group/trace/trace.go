@@ -0,0 +1,160 @@
+// Package trace provides an instrumented kyber suite, which computes
+// exactly as the suite it wraps but records the operations done with its
+// points, scalars, XOFs and random streams: scalar multiplications,
+// inversions, encodings and decodings, XOF and random bytes, and so on.
+// Running a protocol such as a DKG or a CoSi round on such a suite tells
+// how much work it costs, and snapshots taken between its phases
+// attribute that work to each of them:
+//
+//   stats := trace.NewStats(trace.Latencies)
+//   suite := trace.New(edwards25519.NewBlakeSHA256Ed25519(), stats)
+//   before := stats.Snapshot()
+//   // ... run a phase of the protocol with suite ...
+//   fmt.Println(stats.Snapshot().Sub(before))
+//
+// The counts can also be exported with expvar, or streamed to a Hook.
+// Instrumentation is opt-in: code using the wrapped suite directly pays
+// nothing, and a traced suite at level Off only an indirection per call.
+//
+// Traced points and scalars must only be combined with those of the same
+// traced suite or of the suite it wraps. Code that needs the concrete
+// types of a given group, such as sign/eddsa, cannot use a traced suite.
+package trace
+
+import (
+	"crypto/cipher"
+	"io"
+	"reflect"
+
+	"github.com/dedis/fixbuf"
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/group/internal/marshalling"
+	"github.com/dedis/kyber/suites"
+)
+
+// Suite is a suites.Suite recording its operations in Stats.
+type Suite struct {
+	suites.Suite
+	stats *Stats
+}
+
+// New returns a suite computing as s does, recording its operations in
+// stats.
+func New(s suites.Suite, stats *Stats) *Suite {
+	return &Suite{s, stats}
+}
+
+// Stats returns the Stats the suite records its operations in.
+func (s *Suite) Stats() *Stats {
+	return s.stats
+}
+
+// Point returns a new traced point.
+func (s *Suite) Point() kyber.Point {
+	return &point{s.Suite.Point(), s.stats}
+}
+
+// Scalar returns a new traced scalar.
+func (s *Suite) Scalar() kyber.Scalar {
+	return &scalar{s.Suite.Scalar(), s.stats}
+}
+
+// XOF returns a traced XOF of the wrapped suite.
+func (s *Suite) XOF(seed []byte) kyber.XOF {
+	t := s.stats.begin()
+	x := s.Suite.XOF(seed)
+	s.stats.end(XOFWriteBytes, uint64(len(seed)), t)
+	return &xof{x, s.stats}
+}
+
+// RandomStream returns a traced random stream of the wrapped suite.
+func (s *Suite) RandomStream() cipher.Stream {
+	return &stream{s.Suite.RandomStream(), s.stats}
+}
+
+// UnmarshalPoints decodes bufs into traced points, using the batch
+// decoding of the wrapped suite if it has one.
+func (s *Suite) UnmarshalPoints(bufs [][]byte) ([]kyber.Point, error) {
+	t := s.stats.begin()
+	var points []kyber.Point
+	if bu, ok := s.Suite.(kyber.BatchUnmarshaler); ok {
+		var err error
+		if points, err = bu.UnmarshalPoints(bufs); err != nil {
+			return nil, err
+		}
+	} else {
+		points = make([]kyber.Point, len(bufs))
+		for i, buf := range bufs {
+			points[i] = s.Suite.Point()
+			if err := points[i].UnmarshalBinary(buf); err != nil {
+				return nil, err
+			}
+		}
+	}
+	for i := range points {
+		points[i] = &point{points[i], s.stats}
+	}
+	s.stats.end(PointDecode, uint64(len(bufs)), t)
+	return points, nil
+}
+
+// Read decodes objs from r, with traced points and scalars.
+func (s *Suite) Read(r io.Reader, objs ...interface{}) error {
+	return fixbuf.Read(r, s, objs...)
+}
+
+// Write encodes objs to w.
+func (s *Suite) Write(w io.Writer, objs ...interface{}) error {
+	return fixbuf.Write(w, objs)
+}
+
+// New implements the kyber.Encoding interface.
+func (s *Suite) New(t reflect.Type) interface{} {
+	return marshalling.GroupNew(s, t)
+}
+
+// xof is a kyber.XOF counting the bytes it absorbs and outputs.
+type xof struct {
+	x     kyber.XOF
+	stats *Stats
+}
+
+func (x *xof) Write(b []byte) (int, error) {
+	t := x.stats.begin()
+	n, err := x.x.Write(b)
+	x.stats.end(XOFWriteBytes, uint64(n), t)
+	return n, err
+}
+
+func (x *xof) Read(b []byte) (int, error) {
+	t := x.stats.begin()
+	n, err := x.x.Read(b)
+	x.stats.end(XOFReadBytes, uint64(n), t)
+	return n, err
+}
+
+func (x *xof) XORKeyStream(dst, src []byte) {
+	t := x.stats.begin()
+	x.x.XORKeyStream(dst, src)
+	x.stats.end(XOFReadBytes, uint64(len(src)), t)
+}
+
+func (x *xof) Reseed() {
+	x.x.Reseed()
+}
+
+func (x *xof) Clone() kyber.XOF {
+	return &xof{x.x.Clone(), x.stats}
+}
+
+// stream is a cipher.Stream counting the bytes it outputs.
+type stream struct {
+	s     cipher.Stream
+	stats *Stats
+}
+
+func (s *stream) XORKeyStream(dst, src []byte) {
+	t := s.stats.begin()
+	s.s.XORKeyStream(dst, src)
+	s.stats.end(RandomBytes, uint64(len(src)), t)
+}
@@ -0,0 +1,121 @@
+package trace
+
+import (
+	"encoding/json"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/dedis/kyber/group/edwards25519"
+	"github.com/dedis/kyber/sign/schnorr"
+	"github.com/dedis/kyber/util/test"
+	"github.com/stretchr/testify/require"
+)
+
+func TestSuite(t *testing.T) {
+	stats := NewStats(Latencies)
+	test.SuiteTest(New(edwards25519.NewBlakeSHA256Ed25519(), stats))
+	require.True(t, stats.Snapshot().Counts[PointMul] != 0)
+}
+
+func TestCounts(t *testing.T) {
+	stats := NewStats(Counts)
+	suite := New(edwards25519.NewBlakeSHA256Ed25519(), stats)
+
+	s := suite.Scalar().Pick(suite.RandomStream())
+	P := suite.Point().Mul(s, nil)
+	Q := suite.Point().Mul(s, P)
+	suite.Point().Add(P, Q)
+	suite.Scalar().Inv(s)
+	buf, err := Q.MarshalBinary()
+	require.Nil(t, err)
+	require.Nil(t, suite.Point().UnmarshalBinary(buf))
+
+	snap := stats.Snapshot()
+	for op, n := range map[Op]uint64{
+		ScalarPick: 1, PointBaseMul: 1, PointMul: 1, PointAdd: 1,
+		ScalarInv: 1, PointEncode: 1, PointDecode: 1,
+	} {
+		require.Equal(t, n, snap.Counts[op], op.String())
+		require.Equal(t, uint64(0), snap.Nanos[op], op.String())
+	}
+	// Pick rejection-samples 32-byte candidates.
+	random := snap.Counts[RandomBytes]
+	require.True(t, random != 0 && random%32 == 0, "random bytes:", random)
+
+	// The traced suite computes the same values as the wrapped one.
+	require.True(t, suite.Suite.Point().Mul(unwrapScalar(s), nil).Equal(unwrapPoint(P)))
+
+	// Nothing is recorded at level Off, and Reset clears the counts.
+	stats.SetLevel(Off)
+	suite.Point().Mul(s, nil)
+	require.Equal(t, snap, stats.Snapshot())
+	stats.Reset()
+	require.Equal(t, &Snapshot{}, stats.Snapshot())
+}
+
+func TestLatencies(t *testing.T) {
+	stats := NewStats(Latencies)
+	suite := New(edwards25519.NewBlakeSHA256Ed25519(), stats)
+	var hooked uint64
+	stats.SetHook(func(op Op, n uint64, d time.Duration) {
+		if op == PointBaseMul && d > 0 {
+			atomic.AddUint64(&hooked, n)
+		}
+	})
+
+	private := suite.Scalar().Pick(suite.RandomStream())
+	public := suite.Point().Mul(private, nil)
+	before := stats.Snapshot()
+	msg := []byte("traced message")
+	sig, err := schnorr.Sign(suite, private, msg)
+	require.Nil(t, err)
+	require.Nil(t, schnorr.Verify(suite, public, msg, sig))
+	phase := stats.Snapshot().Sub(before)
+
+	// The histograms have one entry per recorded call.
+	require.True(t, phase.Counts[PointBaseMul] != 0)
+	var calls uint64
+	for _, c := range phase.Hist[PointBaseMul] {
+		calls += c
+	}
+	require.Equal(t, phase.Counts[PointBaseMul], calls)
+	require.True(t, phase.Nanos[PointBaseMul] != 0)
+	require.Equal(t, stats.Snapshot().Counts[PointBaseMul], atomic.LoadUint64(&hooked))
+
+	// The snapshot, and so the expvar, is JSON.
+	var out map[string]struct {
+		Count uint64
+		Ns    uint64
+		Hist  []uint64
+	}
+	require.Nil(t, json.Unmarshal([]byte(stats.String()), &out))
+	require.Equal(t, stats.Snapshot().Counts[PointBaseMul], out["PointBaseMul"].Count)
+	require.True(t, len(out["PointBaseMul"].Hist) > 0)
+}
+
+func BenchmarkMulOff(b *testing.B) {
+	benchmarkMul(b, New(edwards25519.NewBlakeSHA256Ed25519(), NewStats(Off)))
+}
+
+func BenchmarkMulLatencies(b *testing.B) {
+	benchmarkMul(b, New(edwards25519.NewBlakeSHA256Ed25519(), NewStats(Latencies)))
+}
+
+func BenchmarkScalarAddOff(b *testing.B) {
+	suite := New(edwards25519.NewBlakeSHA256Ed25519(), NewStats(Off))
+	s := suite.Scalar().Pick(suite.RandomStream())
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		s.Add(s, s)
+	}
+}
+
+func benchmarkMul(b *testing.B, suite *Suite) {
+	s := suite.Scalar().Pick(suite.RandomStream())
+	P := suite.Point().Pick(suite.RandomStream())
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		P.Mul(s, P)
+	}
+}
@@ -0,0 +1,36 @@
+// Package parallel provides the data-parallel loop shared by the packages
+// of kyber which spread independent point and scalar operations over the
+// available CPUs.
+package parallel
+
+import (
+	"runtime"
+	"sync"
+)
+
+// Range splits [0, n) into contiguous ranges, one per available CPU, and
+// calls f on each of them concurrently. Each index is meant to cost at
+// least a scalar multiplication, so every CPU gets a range as long as
+// there are indices left; with a single range, f runs on the calling
+// goroutine.
+func Range(n int, f func(lo, hi int)) {
+	workers := runtime.GOMAXPROCS(0)
+	if workers > n {
+		workers = n
+	}
+	if workers <= 1 {
+		if n > 0 {
+			f(0, n)
+		}
+		return
+	}
+	var wg sync.WaitGroup
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func(lo, hi int) {
+			defer wg.Done()
+			f(lo, hi)
+		}(w*n/workers, (w+1)*n/workers)
+	}
+	wg.Wait()
+}
@@ -0,0 +1,32 @@
+package parallel
+
+import (
+	"runtime"
+	"sync/atomic"
+	"testing"
+)
+
+func TestRange(t *testing.T) {
+	defer runtime.GOMAXPROCS(runtime.GOMAXPROCS(4))
+	for _, n := range []int{0, 1, 3, 4, 100} {
+		seen := make([]int32, n)
+		var calls int32
+		Range(n, func(lo, hi int) {
+			atomic.AddInt32(&calls, 1)
+			if lo >= hi {
+				t.Errorf("n = %d: empty range [%d, %d)", n, lo, hi)
+			}
+			for i := lo; i < hi; i++ {
+				atomic.AddInt32(&seen[i], 1)
+			}
+		})
+		for i, c := range seen {
+			if c != 1 {
+				t.Fatalf("n = %d: index %d covered %d times", n, i, c)
+			}
+		}
+		if n > 4 && calls != 4 {
+			t.Fatalf("n = %d: %d ranges for 4 CPUs", n, calls)
+		}
+	}
+}
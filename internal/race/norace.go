@@ -0,0 +1,6 @@
+// +build !race
+
+package race
+
+// Enabled reports whether the race detector is on.
+const Enabled = false
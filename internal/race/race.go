@@ -0,0 +1,9 @@
+// +build race
+
+// Package race reports whether the race detector is on, for the tests of
+// kyber which check allocation counts or sync.Pool reuse, neither of which
+// holds under the race detector.
+package race
+
+// Enabled reports whether the race detector is on.
+const Enabled = true
@@ -9,6 +9,8 @@ import (
 	"errors"
 
 	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/util/msm"
+	"github.com/dedis/kyber/util/random"
 )
 
 // Suite wraps the functionalities needed by the dleq package.
@@ -47,10 +49,11 @@ func NewDLEQProof(suite Suite, G kyber.Point, H kyber.Point, x kyber.Scalar) (pr
 
 	// Challenge
 	h := suite.Hash()
-	xG.MarshalTo(h)
-	xH.MarshalTo(h)
-	vG.MarshalTo(h)
-	vH.MarshalTo(h)
+	var buf []byte
+	for _, p := range []kyber.Point{xG, xH, vG, vH} {
+		buf, _ = p.AppendBinary(buf)
+	}
+	h.Write(buf)
 	cb := h.Sum(nil)
 	c := suite.Scalar().Pick(suite.XOF(cb))
 
@@ -63,14 +66,38 @@ func NewDLEQProof(suite Suite, G kyber.Point, H kyber.Point, x kyber.Scalar) (pr
 
 // NewDLEQProofBatch computes lists of NIZK dlog-equality proofs and of
 // encrypted base points xG and xH. Note that the challenge is computed over all
-// input values.
+// input values. NewBatchProof computes the same proofs in a compact form.
 func NewDLEQProofBatch(suite Suite, G []kyber.Point, H []kyber.Point, secrets []kyber.Scalar) (proof []*Proof, xG []kyber.Point, xH []kyber.Point, err error) {
+	bp, xG, xH, err := NewBatchProof(suite, G, H, secrets)
+	if err != nil {
+		return nil, nil, nil, err
+	}
+	proofs := make([]*Proof, len(secrets))
+	for i := range proofs {
+		proofs[i] = &Proof{bp.C, bp.R[i], bp.VG[i], bp.VH[i]}
+	}
+	return proofs, xG, xH, nil
+}
+
+// BatchProof represents a list of NIZK dlog-equality proofs sharing a
+// collective challenge, which is therefore only stored once.
+type BatchProof struct {
+	C  kyber.Scalar   // collective challenge
+	R  []kyber.Scalar // responses
+	VG []kyber.Point  // public commitments with respect to the base points G
+	VH []kyber.Point  // public commitments with respect to the base points H
+}
+
+// NewBatchProof computes a batch of NIZK dlog-equality proofs for the
+// secrets[i] with respect to the base points G[i] and H[i], with the
+// collective challenge c = H(xG,xH,vG,vH) over all input values. Besides the
+// proof, this function also returns the encrypted base points xG and xH.
+func NewBatchProof(suite Suite, G []kyber.Point, H []kyber.Point, secrets []kyber.Scalar) (proof *BatchProof, xG []kyber.Point, xH []kyber.Point, err error) {
 	if len(G) != len(H) || len(H) != len(secrets) {
 		return nil, nil, nil, errorDifferentLengths
 	}
 
 	n := len(secrets)
-	proofs := make([]*Proof, n)
 	v := make([]kyber.Scalar, n)
 	xG = make([]kyber.Point, n)
 	xH = make([]kyber.Point, n)
@@ -89,31 +116,70 @@ func NewDLEQProofBatch(suite Suite, G []kyber.Point, H []kyber.Point, secrets []
 	}
 
 	// Collective challenge
-	h := suite.Hash()
-	for _, x := range xG {
-		x.MarshalTo(h)
-	}
-	for _, x := range xH {
-		x.MarshalTo(h)
-	}
-	for _, x := range vG {
-		x.MarshalTo(h)
+	c, err := batchChallenge(suite, xG, xH, vG, vH)
+	if err != nil {
+		return nil, nil, nil, err
 	}
-	for _, x := range vH {
-		x.MarshalTo(h)
-	}
-	cb := h.Sum(nil)
-
-	c := suite.Scalar().Pick(suite.XOF(cb))
 
 	// Responses
+	r := make([]kyber.Scalar, n)
 	for i, x := range secrets {
-		r := suite.Scalar()
-		r.Mul(x, c).Sub(v[i], r)
-		proofs[i] = &Proof{c, r, vG[i], vH[i]}
+		r[i] = suite.Scalar()
+		r[i].Mul(x, c).Sub(v[i], r[i])
 	}
 
-	return proofs, xG, xH, nil
+	return &BatchProof{c, r, vG, vH}, xG, xH, nil
+}
+
+// batchChallenge computes the collective challenge c = H(xG,xH,vG,vH),
+// streaming the encodings of all points into the hash.
+func batchChallenge(suite Suite, xG, xH, vG, vH []kyber.Point) (kyber.Scalar, error) {
+	h := suite.Hash()
+	var b []byte
+	for _, points := range [][]kyber.Point{xG, xH, vG, vH} {
+		for _, p := range points {
+			var err error
+			if b, err = p.AppendBinary(b[:0]); err != nil {
+				return nil, err
+			}
+			h.Write(b)
+		}
+	}
+	cb := h.Sum(nil)
+	return suite.Scalar().Pick(suite.XOF(cb)), nil
+}
+
+// Verify examines the validity of the batch of NIZK dlog-equality proofs for
+// the points G[i], H[i], xG[i] and xH[i]. The batch is valid if the
+// collective challenge matches the inputs and the conditions
+//   vG[i] == r[i]G[i] + c(xG[i])
+//   vH[i] == r[i]H[i] + c(xH[i])
+// hold for every i. They are checked all at once as in VerifyBatch, with a
+// single multi-scalar multiplication, and thus only up to small-order
+// components. Since a single invalid proof breaks the collective challenge,
+// Verify only tells whether the whole batch is valid.
+func (p *BatchProof) Verify(suite Suite, G []kyber.Point, H []kyber.Point, xG []kyber.Point, xH []kyber.Point) error {
+	n := len(p.R)
+	if len(p.VG) != n || len(p.VH) != n || len(G) != n || len(H) != n ||
+		len(xG) != n || len(xH) != n {
+		return errorDifferentLengths
+	}
+	c, err := batchChallenge(suite, xG, xH, p.VG, p.VH)
+	if err != nil {
+		return err
+	}
+	if !c.Equal(p.C) {
+		return errorInvalidProof
+	}
+	proofs := make([]*Proof, n)
+	for i := range proofs {
+		proofs[i] = &Proof{p.C, p.R[i], p.VG[i], p.VH[i]}
+	}
+	b := newBatch(suite, G, H, xG, xH, proofs)
+	if n > 0 && !b.holds(b.all()) {
+		return errorInvalidProof
+	}
+	return nil
 }
 
 // Verify examines the validity of the NIZK dlog-equality proof.
@@ -121,14 +187,153 @@ func NewDLEQProofBatch(suite Suite, G []kyber.Point, H []kyber.Point, secrets []
 //   vG == rG + c(xG)
 //   vH == rH + c(xH)
 func (p *Proof) Verify(suite Suite, G kyber.Point, H kyber.Point, xG kyber.Point, xH kyber.Point) error {
+	return p.verify(suite, G, H, xG, xH, kyber.Point.Equal)
+}
+
+// VerifyCofactored is like Verify but, in groups whose points implement
+// kyber.CofactorComparable, only checks the two conditions up to small-order
+// components. It then also accepts proofs whose commitments or points are
+// off by such components, which Verify rejects. In other groups it is the
+// same as Verify.
+func (p *Proof) VerifyCofactored(suite Suite, G kyber.Point, H kyber.Point, xG kyber.Point, xH kyber.Point) error {
+	return p.verify(suite, G, H, xG, xH, equalCofactor)
+}
+
+func (p *Proof) verify(suite Suite, G, H, xG, xH kyber.Point, equal func(P, Q kyber.Point) bool) error {
 	rG := suite.Point().Mul(p.R, G)
 	rH := suite.Point().Mul(p.R, H)
 	cxG := suite.Point().Mul(p.C, xG)
 	cxH := suite.Point().Mul(p.C, xH)
 	a := suite.Point().Add(rG, cxG)
 	b := suite.Point().Add(rH, cxH)
-	if !(p.VG.Equal(a) && p.VH.Equal(b)) {
+	if !(equal(p.VG, a) && equal(p.VH, b)) {
 		return errorInvalidProof
 	}
 	return nil
 }
+
+// equalCofactor compares P and Q up to small-order components if their
+// group supports it, and exactly otherwise.
+func equalCofactor(P, Q kyber.Point) bool {
+	if c, ok := P.(kyber.CofactorComparable); ok {
+		return c.EqualCofactor(Q)
+	}
+	return P.Equal(Q)
+}
+
+// VerifyBatch examines the validity of the NIZK dlog-equality proofs[i] for
+// the points G[i], H[i], xG[i] and xH[i] all at once: instead of checking the
+// verification equations of every proof, it checks a random linear
+// combination of all of them with a single multi-scalar multiplication, in
+// which base points shared by several proofs, such as a common H, only
+// appear once. If all proofs are valid, VerifyBatch returns nil. Otherwise,
+// it bisects the batch to locate the invalid proofs, which costs a few more
+// combined checks per invalid proof, and returns a slice with one entry per
+// proof, which is nil for valid proofs and the error returned by
+// VerifyCofactored for invalid ones.
+//
+// The random weights cannot be relied upon to cancel small-order components
+// of the points or commitments, so on groups with a cofactor, such as
+// Ed25519, the combined equation is compared up to such components. The
+// verdict on every proof is thus the one of VerifyCofactored, which may
+// accept proofs that Verify rejects. Callers who need the verdict of Verify
+// should first check that the points lie in the prime-order subgroup, e.g.
+// with kyber.SubgroupCheckable, as both verdicts then agree. VerifyBatch
+// panics if the five slices differ in length.
+func VerifyBatch(suite Suite, G, H, xG, xH []kyber.Point, proofs []*Proof) []error {
+	n := len(proofs)
+	if len(G) != n || len(H) != n || len(xG) != n || len(xH) != n {
+		panic("dleq: " + errorDifferentLengths.Error())
+	}
+	b := newBatch(suite, G, H, xG, xH, proofs)
+	idx := b.all()
+	if n == 0 || b.holds(idx) {
+		return nil
+	}
+	b.errs = make([]error, n)
+	b.bisect(idx)
+	return b.errs
+}
+
+// batch holds the weighted terms of a batch of proofs to verify at once.
+type batch struct {
+	suite        Suite
+	G, H, xG, xH []kyber.Point
+	proofs       []*Proof
+	terms        [][6]kyber.Scalar // coefficients of G, xG, vG, H, xH, vH
+	errs         []error
+}
+
+// newBatch weights the equations of proof i, vG == rG + c(xG) and
+// vH == rH + c(xH), with independent random z_i and w_i:
+//   z_i(rG + c(xG) - vG) + w_i(rH + c(xH) - vH) == 0
+func newBatch(suite Suite, G, H, xG, xH []kyber.Point, proofs []*Proof) *batch {
+	b := &batch{suite: suite, G: G, H: H, xG: xG, xH: xH, proofs: proofs,
+		terms: make([][6]kyber.Scalar, len(proofs))}
+	stream := random.New()
+	for i, p := range proofs {
+		z := suite.Scalar().Pick(stream)
+		w := suite.Scalar().Pick(stream)
+		b.terms[i] = [6]kyber.Scalar{
+			suite.Scalar().Mul(z, p.R), suite.Scalar().Mul(z, p.C), suite.Scalar().Neg(z),
+			suite.Scalar().Mul(w, p.R), suite.Scalar().Mul(w, p.C), suite.Scalar().Neg(w),
+		}
+	}
+	return b
+}
+
+// all returns the indices of all proofs of the batch.
+func (b *batch) all() []int {
+	idx := make([]int, len(b.proofs))
+	for i := range idx {
+		idx[i] = i
+	}
+	return idx
+}
+
+// holds returns whether the combined equation of the proofs idx holds.
+func (b *batch) holds(idx []int) bool {
+	scalars := make([]kyber.Scalar, 0, 6*len(idx))
+	points := make([]kyber.Point, 0, 6*len(idx))
+	bases := make(map[kyber.Point]int) // position of the coefficient of G or H
+	base := func(s kyber.Scalar, P kyber.Point) {
+		if k, ok := bases[P]; ok {
+			scalars[k] = scalars[k].Add(scalars[k], s)
+			return
+		}
+		bases[P] = len(scalars)
+		scalars = append(scalars, b.suite.Scalar().Set(s))
+		points = append(points, P)
+	}
+	for _, i := range idx {
+		t, p := &b.terms[i], b.proofs[i]
+		base(t[0], b.G[i])
+		base(t[3], b.H[i])
+		scalars = append(scalars, t[1], t[2], t[4], t[5])
+		points = append(points, b.xG[i], p.VG, b.xH[i], p.VH)
+	}
+	sum := msm.Sum(b.suite.Point(), scalars, points)
+	return equalCofactor(sum, b.suite.Point().Null())
+}
+
+// bisect locates the invalid proofs among idx, whose combined equation is
+// known to fail, and records their errors. Single proofs are left to
+// VerifyCofactored, so a spurious failure of the combined check never
+// rejects a valid proof.
+func (b *batch) bisect(idx []int) {
+	if len(idx) == 1 {
+		i := idx[0]
+		b.errs[i] = b.proofs[i].VerifyCofactored(b.suite, b.G[i], b.H[i], b.xG[i], b.xH[i])
+		return
+	}
+	left, right := idx[:len(idx)/2], idx[len(idx)/2:]
+	if b.holds(left) {
+		// then the failure lies in the right half
+		b.bisect(right)
+		return
+	}
+	b.bisect(left)
+	if !b.holds(right) {
+		b.bisect(right)
+	}
+}
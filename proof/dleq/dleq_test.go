@@ -1,6 +1,7 @@
 package dleq
 
 import (
+	"bytes"
 	"testing"
 
 	"github.com/dedis/kyber"
@@ -59,3 +60,142 @@ func TestDLEQLengths(t *testing.T) {
 	_, _, _, err := NewDLEQProofBatch(suite, g, h, x)
 	require.Equal(t, err, errorDifferentLengths)
 }
+
+func batchProofs(suite Suite, n int) (g, h, xG, xH []kyber.Point, proofs []*Proof) {
+	x := make([]kyber.Scalar, n)
+	g = make([]kyber.Point, n)
+	h = make([]kyber.Point, n)
+	G := suite.Point().Pick(rng)
+	for i := range x {
+		x[i] = suite.Scalar().Pick(rng)
+		g[i] = G
+		h[i] = suite.Point().Pick(rng)
+	}
+	proofs, xG, xH, _ = NewDLEQProofBatch(suite, g, h, x)
+	return
+}
+
+func TestDLEQVerifyBatch(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	n := 13
+	g, h, xG, xH, proofs := batchProofs(suite, n)
+	require.Nil(t, VerifyBatch(suite, g, h, xG, xH, proofs))
+	require.Nil(t, VerifyBatch(suite, nil, nil, nil, nil, nil))
+
+	// Corrupt a few proofs in different ways
+	bad := map[int]bool{0: true, 5: true, 6: true, 12: true}
+	proofs[0].R = suite.Scalar().Pick(rng)
+	xH[5] = suite.Point().Pick(rng)
+	proofs[6].VG = suite.Point().Pick(rng)
+	proofs[12].VH = suite.Point().Pick(rng)
+	errs := VerifyBatch(suite, g, h, xG, xH, proofs)
+	require.Len(t, errs, n)
+	for i, err := range errs {
+		if bad[i] {
+			require.Equal(t, errorInvalidProof, err)
+		} else {
+			require.Nil(t, err)
+			require.Nil(t, proofs[i].Verify(suite, g[i], h[i], xG[i], xH[i]))
+		}
+	}
+
+	require.Panics(t, func() { VerifyBatch(suite, g[1:], h, xG, xH, proofs) })
+}
+
+func TestDLEQVerifyCofactored(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	n := 4
+	g, h, xG, xH, proofs := batchProofs(suite, n)
+
+	// Shift a commitment by the order-2 point (0,-1).
+	T := suite.Point()
+	require.Nil(t, T.UnmarshalBinary(append([]byte{0xec}, append(bytes.Repeat([]byte{0xff}, 30), 0x7f)...)))
+	proofs[1].VG = suite.Point().Add(proofs[1].VG, T)
+	require.Equal(t, errorInvalidProof, proofs[1].Verify(suite, g[1], h[1], xG[1], xH[1]))
+	require.Nil(t, proofs[1].VerifyCofactored(suite, g[1], h[1], xG[1], xH[1]))
+	for i := 0; i < 20; i++ {
+		// The batch must agree with VerifyCofactored whatever the weights.
+		require.Nil(t, VerifyBatch(suite, g, h, xG, xH, proofs))
+	}
+
+	proofs[2].VH = suite.Point().Pick(rng)
+	errs := VerifyBatch(suite, g, h, xG, xH, proofs)
+	require.Len(t, errs, n)
+	for i, err := range errs {
+		if i == 2 {
+			require.Equal(t, errorInvalidProof, err)
+		} else {
+			require.Nil(t, err)
+		}
+	}
+}
+
+func benchmarkVerify(b *testing.B, batch bool) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	g, h, xG, xH, proofs := batchProofs(suite, 100)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if batch {
+			VerifyBatch(suite, g, h, xG, xH, proofs)
+			continue
+		}
+		for j, p := range proofs {
+			p.Verify(suite, g[j], h[j], xG[j], xH[j])
+		}
+	}
+}
+
+func BenchmarkVerify100(b *testing.B)      { benchmarkVerify(b, false) }
+func BenchmarkVerifyBatch100(b *testing.B) { benchmarkVerify(b, true) }
+
+func TestDLEQBatchProof(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	n := 10
+	x := make([]kyber.Scalar, n)
+	g := make([]kyber.Point, n)
+	h := make([]kyber.Point, n)
+	for i := range x {
+		x[i] = suite.Scalar().Pick(rng)
+		g[i] = suite.Point().Pick(rng)
+		h[i] = suite.Point().Pick(rng)
+	}
+	proof, xG, xH, err := NewBatchProof(suite, g, h, x)
+	require.Nil(t, err)
+	require.Nil(t, proof.Verify(suite, g, h, xG, xH))
+	for i := range x {
+		p := &Proof{proof.C, proof.R[i], proof.VG[i], proof.VH[i]}
+		require.Nil(t, p.Verify(suite, g[i], h[i], xG[i], xH[i]))
+	}
+
+	// Changing any input breaks the collective challenge
+	xH[3] = suite.Point().Pick(rng)
+	require.Equal(t, errorInvalidProof, proof.Verify(suite, g, h, xG, xH))
+	xH[3] = suite.Point().Mul(x[3], h[3])
+
+	// while a wrong response fails the combined equation
+	proof.R[7] = suite.Scalar().Pick(rng)
+	require.Equal(t, errorInvalidProof, proof.Verify(suite, g, h, xG, xH))
+
+	require.Equal(t, errorDifferentLengths, proof.Verify(suite, g[1:], h, xG, xH))
+	_, _, _, err = NewBatchProof(suite, g, h, x[1:])
+	require.Equal(t, errorDifferentLengths, err)
+}
+
+func BenchmarkBatchProofVerify100(b *testing.B) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	n := 100
+	x := make([]kyber.Scalar, n)
+	g := make([]kyber.Point, n)
+	h := make([]kyber.Point, n)
+	G := suite.Point().Pick(rng)
+	for i := range x {
+		x[i] = suite.Scalar().Pick(rng)
+		g[i] = G
+		h[i] = suite.Point().Pick(rng)
+	}
+	proof, xG, xH, _ := NewBatchProof(suite, g, h, x)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		proof.Verify(suite, g, h, xG, xH)
+	}
+}
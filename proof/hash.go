@@ -5,6 +5,7 @@ package proof
 import (
 	"bytes"
 	"fmt"
+	"io"
 
 	"github.com/dedis/kyber"
 )
@@ -13,7 +14,7 @@ import (
 type hashProver struct {
 	suite   Suite
 	proof   bytes.Buffer
-	msg     bytes.Buffer
+	msg     []byte
 	pubrand kyber.XOF
 	prirand kyber.XOF
 }
@@ -27,20 +28,29 @@ func newHashProver(suite Suite, protoName string) *hashProver {
 }
 
 func (c *hashProver) Put(message interface{}) error {
-	return c.suite.Write(&c.msg, message)
+	// Points and scalars, the common case, append their own encoding
+	// without going through the reflection of suite.Write.
+	if m, ok := message.(kyber.Marshaling); ok {
+		var err error
+		c.msg, err = m.AppendBinary(c.msg)
+		return err
+	}
+	buf := bytes.NewBuffer(c.msg)
+	err := c.suite.Write(buf, message)
+	c.msg = buf.Bytes()
+	return err
 }
 
 func (c *hashProver) consumeMsg() {
-	if c.msg.Len() > 0 {
+	if len(c.msg) > 0 {
 
 		// Stir the message into the public randomness pool
-		buf := c.msg.Bytes()
 		c.pubrand.Reseed()
-		c.pubrand.Write(buf)
+		c.pubrand.Write(c.msg)
 
 		// Append the current message data to the proof
-		c.proof.Write(buf)
-		c.msg.Reset()
+		c.proof.Write(c.msg)
+		c.msg = c.msg[:0]
 	}
 }
 
@@ -98,6 +108,13 @@ func (c *hashVerifier) consumeMsg() {
 
 // Read structured data from the proof
 func (c *hashVerifier) Get(message interface{}) error {
+	if m, ok := message.(kyber.Marshaling); ok {
+		n := m.MarshalSize()
+		if c.proof.Len() < n {
+			return io.ErrUnexpectedEOF
+		}
+		return m.UnmarshalBinary(c.proof.Next(n))
+	}
 	return c.suite.Read(&c.proof, message)
 }
 
@@ -0,0 +1,508 @@
+// +build experimental
+
+package proof
+
+import (
+	"errors"
+	"sort"
+	"sync"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/util/msm"
+)
+
+/*
+A Plan is a Predicate compiled for a given Suite, for statements of the same
+shape that are proven or verified many times.
+
+Compile resolves every variable name to an integer slot once, so that the
+provers and verifiers of a Plan take their secrets and points as slices
+indexed by slot instead of maps, and it flattens the predicate into a list
+of nodes whose OR-domains, and the secrets each of them uses, are known in
+advance. The scalars and points a run needs are allocated once and reused
+by later runs, and verifiers recompute each Rep commitment with a single
+multi-scalar multiplication. Prover commitments, which depend on secret
+blinding factors, still use constant time Mul.
+
+Proofs produced through a Plan are identical to those of the Predicate it
+was compiled from, so either can verify the other's proofs.
+A Plan is immutable and safe for concurrent use.
+*/
+type Plan struct {
+	suite      Suite
+	svar, pvar []string // variable names by slot
+	sidx, pidx map[string]int
+	nodes      []planNode // in preorder, nodes[0] is the root
+	domains    []planDomain
+	pool       sync.Pool
+}
+
+// planNode kinds
+const (
+	planRep = iota
+	planAnd
+	planOr
+)
+
+type planNode struct {
+	kind   int
+	pred   Predicate // source predicate, the key of Or nodes in choice maps
+	sub    []int     // And, Or: indices of the sub-nodes
+	domain int       // Rep, And: index of the OR-domain of the node
+	root   bool      // Rep, And: whether the node opens its domain
+	P      int       // Rep: slot of the public point
+	S, B   []int     // Rep: slots of the secret and base of each term
+	fresh  []int     // Rep: secret slots first used in the domain by the node
+}
+
+// planDomain is an OR-domain: a subtree sharing one set of blinding
+// factors and responses, which is the whole predicate or a branch of an Or.
+type planDomain struct {
+	used []int // slots of the secrets used in the domain, in increasing order
+}
+
+// Compile compiles pred into a Plan for suite. It fails if pred contains
+// an Or predicate within an And predicate.
+func Compile(suite Suite, pred Predicate) (*Plan, error) {
+	// Number the variables as the interpreter does, without its reserved
+	// slot 0.
+	prf := proof{}.init(suite, pred)
+	p := &Plan{
+		suite: suite,
+		svar:  prf.svar[1:],
+		pvar:  prf.pvar[1:],
+		sidx:  make(map[string]int),
+		pidx:  make(map[string]int),
+	}
+	for i, name := range p.svar {
+		p.sidx[name] = i
+	}
+	for i, name := range p.pvar {
+		p.pidx[name] = i
+	}
+
+	var seen []map[int]bool // secrets seen so far in each domain
+	var walk func(pred Predicate, domain int) (int, error)
+	walk = func(pred Predicate, domain int) (int, error) {
+		n := len(p.nodes)
+		p.nodes = append(p.nodes, planNode{pred: pred, domain: domain})
+		root := false
+		if _, isOr := pred.(*orPred); !isOr && domain < 0 {
+			domain, root = len(p.domains), true
+			p.domains = append(p.domains, planDomain{})
+			seen = append(seen, make(map[int]bool))
+		}
+
+		switch pr := pred.(type) {
+		case *repPred:
+			node := planNode{kind: planRep, pred: pred, domain: domain,
+				root: root, P: p.pidx[pr.P]}
+			for _, t := range pr.T {
+				s := p.sidx[t.S]
+				node.S = append(node.S, s)
+				node.B = append(node.B, p.pidx[t.B])
+				if !seen[domain][s] {
+					seen[domain][s] = true
+					node.fresh = append(node.fresh, s)
+				}
+			}
+			p.nodes[n] = node
+
+		case *andPred:
+			var sub []int
+			for _, sp := range *pr {
+				i, err := walk(sp, domain)
+				if err != nil {
+					return 0, err
+				}
+				sub = append(sub, i)
+			}
+			p.nodes[n] = planNode{kind: planAnd, pred: pred, sub: sub,
+				domain: domain, root: root}
+
+		case *orPred:
+			if domain >= 0 {
+				return 0, errors.New("can't have OR predicates within AND predicates")
+			}
+			var sub []int
+			for _, sp := range *pr {
+				i, err := walk(sp, -1)
+				if err != nil {
+					return 0, err
+				}
+				sub = append(sub, i)
+			}
+			p.nodes[n] = planNode{kind: planOr, pred: pred, sub: sub, domain: -1}
+
+		default:
+			return 0, errors.New("unsupported predicate " + pred.String())
+		}
+		return n, nil
+	}
+	if _, err := walk(pred, -1); err != nil {
+		return nil, err
+	}
+
+	for d := range p.domains {
+		for s := range seen[d] {
+			p.domains[d].used = append(p.domains[d].used, s)
+		}
+		sort.Ints(p.domains[d].used)
+	}
+	p.pool.New = func() interface{} { return p.newState() }
+	return p, nil
+}
+
+// ScalarNames returns the names of the secret variables by slot.
+func (p *Plan) ScalarNames() []string {
+	return append([]string(nil), p.svar...)
+}
+
+// PointNames returns the names of the public point variables by slot.
+func (p *Plan) PointNames() []string {
+	return append([]string(nil), p.pvar...)
+}
+
+// ScalarIndex returns the slot of the secret variable name, or -1.
+func (p *Plan) ScalarIndex(name string) int {
+	if i, ok := p.sidx[name]; ok {
+		return i
+	}
+	return -1
+}
+
+// PointIndex returns the slot of the public point variable name, or -1.
+func (p *Plan) PointIndex(name string) int {
+	if i, ok := p.pidx[name]; ok {
+		return i
+	}
+	return -1
+}
+
+// Prover creates a Prover for the plan's statement, with the values of the
+// secret and point variables given by slot. As for Predicate.Prover, choice
+// gives the branch to prove for each Or predicate on the proof-obligated path.
+func (p *Plan) Prover(secrets []kyber.Scalar, points []kyber.Point,
+	choice map[Predicate]int) Prover {
+	return Prover(func(ctx ProverContext) error {
+		if len(secrets) != len(p.svar) || len(points) != len(p.pvar) {
+			return errors.New("wrong number of variables for proof plan")
+		}
+		st := p.pool.Get().(*planState)
+		defer p.pool.Put(st)
+		st.sval, st.pval, st.choice, st.pc = secrets, points, choice, ctx
+		defer st.reset()
+		return st.prove()
+	})
+}
+
+// Verifier creates a Verifier for the plan's statement, with the values of
+// the point variables given by slot.
+func (p *Plan) Verifier(points []kyber.Point) Verifier {
+	return Verifier(func(ctx VerifierContext) error {
+		if len(points) != len(p.pvar) {
+			return errors.New("wrong number of variables for proof plan")
+		}
+		st := p.pool.Get().(*planState)
+		defer p.pool.Put(st)
+		st.pval, st.vc = points, ctx
+		defer st.reset()
+		return st.verify()
+	})
+}
+
+// planState holds the scalars and points of one run of a Plan.
+type planState struct {
+	p *Plan
+
+	v, r   [][]kyber.Scalar // per domain and slot: blinding factors, responses
+	w      []kyber.Scalar   // per domain: pre-challenge, nil if proof-obligated
+	ci     [][]kyber.Scalar // per Or node: sub-challenges
+	chosen []int            // per Or node: proof-obligated sub, or -1
+	V      []kyber.Point    // per Rep node: commitment
+	ms     [][]kyber.Scalar // per Rep node: verifier terms c, r[S[0]], ...
+	mp     [][]kyber.Point  // per Rep node: verifier terms P, B[0], ...
+	c, sum kyber.Scalar
+	tmp    kyber.Point
+
+	sval   []kyber.Scalar
+	pval   []kyber.Point
+	choice map[Predicate]int
+	pc     ProverContext
+	vc     VerifierContext
+}
+
+func (p *Plan) newState() *planState {
+	s := p.suite
+	st := &planState{
+		p:      p,
+		v:      make([][]kyber.Scalar, len(p.domains)),
+		r:      make([][]kyber.Scalar, len(p.domains)),
+		w:      make([]kyber.Scalar, len(p.domains)),
+		ci:     make([][]kyber.Scalar, len(p.nodes)),
+		chosen: make([]int, len(p.nodes)),
+		V:      make([]kyber.Point, len(p.nodes)),
+		ms:     make([][]kyber.Scalar, len(p.nodes)),
+		mp:     make([][]kyber.Point, len(p.nodes)),
+		c:      s.Scalar(),
+		sum:    s.Scalar(),
+		tmp:    s.Point(),
+	}
+	for d := range p.domains {
+		st.v[d] = make([]kyber.Scalar, len(p.svar))
+		st.r[d] = make([]kyber.Scalar, len(p.svar))
+		for _, i := range p.domains[d].used {
+			st.v[d][i] = s.Scalar()
+			st.r[d][i] = s.Scalar()
+		}
+	}
+	for n := range p.nodes {
+		node := &p.nodes[n]
+		switch node.kind {
+		case planOr:
+			st.ci[n] = make([]kyber.Scalar, len(node.sub))
+			for i := range st.ci[n] {
+				st.ci[n][i] = s.Scalar()
+			}
+		case planRep:
+			st.V[n] = s.Point()
+			st.ms[n] = make([]kyber.Scalar, 1+len(node.S))
+			for i, slot := range node.S {
+				st.ms[n][1+i] = st.r[node.domain][slot]
+			}
+			st.mp[n] = make([]kyber.Point, 1+len(node.B))
+		}
+	}
+	return st
+}
+
+// reset drops the references to the caller's values before the state
+// returns to the pool, and after a proof, clears the blinding factors,
+// which together with the public responses and challenge give away the
+// secrets.
+func (st *planState) reset() {
+	if st.pc != nil {
+		for _, v := range st.v {
+			for _, vi := range v {
+				if vi != nil {
+					vi.Zero()
+				}
+			}
+		}
+		st.sum.Zero()
+	}
+	st.sval, st.pval, st.choice, st.pc, st.vc = nil, nil, nil, nil, nil
+	for n := range st.mp {
+		for i := range st.mp[n] {
+			st.mp[n][i] = nil
+		}
+	}
+}
+
+func (st *planState) prove() error {
+	if err := st.commit(0, nil); err != nil {
+		return err
+	}
+	if err := st.pc.PubRand(st.c); err != nil {
+		return err
+	}
+	return st.respond(0, st.c)
+}
+
+// commit produces the commitments of node n, with pre-challenge w, or nil
+// on the proof-obligated path, as the commit methods of the predicates do.
+func (st *planState) commit(n int, w kyber.Scalar) error {
+	p := st.p
+	node := &p.nodes[n]
+	switch node.kind {
+	case planOr:
+		ci := st.ci[n]
+		if w == nil {
+			choice, ok := st.choice[node.pred]
+			if !ok || choice < 0 || choice >= len(ci) {
+				return errors.New("no choice of proof branch for OR-predicate " +
+					node.pred.String())
+			}
+			st.chosen[n] = choice
+			for i := range ci {
+				if i != choice {
+					st.pc.PriRand(ci[i])
+				}
+			}
+		} else {
+			st.chosen[n] = -1
+			last := len(ci) - 1
+			ci[last].Set(w)
+			for i := 0; i < last; i++ {
+				st.pc.PriRand(ci[i])
+				ci[last].Sub(ci[last], ci[i])
+			}
+		}
+		for i, sub := range node.sub {
+			wi := ci[i]
+			if i == st.chosen[n] {
+				wi = nil
+			}
+			if err := st.commit(sub, wi); err != nil {
+				return err
+			}
+		}
+		return nil
+
+	case planAnd:
+		if node.root {
+			st.w[node.domain] = w
+		}
+		for _, sub := range node.sub {
+			if err := st.commit(sub, w); err != nil {
+				return err
+			}
+		}
+		return nil
+	}
+
+	// Rep: V = wP + v1B1 + ... + vkBk
+	if node.root {
+		st.w[node.domain] = w
+	}
+	v := st.v[node.domain]
+	V := st.V[n]
+	if w != nil {
+		V.Mul(w, st.pval[node.P])
+	} else {
+		V.Null()
+	}
+	fresh := node.fresh
+	for i, s := range node.S {
+		if len(fresh) > 0 && fresh[0] == s {
+			st.pc.PriRand(v[s])
+			fresh = fresh[1:]
+		}
+		V.Add(V, st.tmp.Mul(v[s], st.pval[node.B[i]]))
+	}
+	return st.pc.Put(V)
+}
+
+// respond produces the responses of node n to challenge c.
+func (st *planState) respond(n int, c kyber.Scalar) error {
+	p := st.p
+	node := &p.nodes[n]
+	if node.kind == planOr {
+		ci := st.ci[n]
+		if choice := st.chosen[n]; choice >= 0 {
+			cs := ci[choice].Set(c)
+			for i := range ci {
+				if i != choice {
+					cs.Sub(cs, ci[i])
+				}
+			}
+		}
+		if len(ci) > 1 {
+			for _, s := range ci {
+				if err := st.pc.Put(s); err != nil {
+					return err
+				}
+			}
+		}
+		for i, sub := range node.sub {
+			if err := st.respond(sub, ci[i]); err != nil {
+				return err
+			}
+		}
+		return nil
+	}
+
+	// A domain answers all at once for its secrets, in slot order:
+	// r = v on a non-obligated branch, r = v - cx otherwise.
+	if !node.root {
+		return nil
+	}
+	d := node.domain
+	v, r := st.v[d], st.r[d]
+	for _, s := range p.domains[d].used {
+		if st.w[d] != nil {
+			r[s].Set(v[s])
+		} else {
+			r[s].Sub(v[s], st.sum.Mul(c, st.sval[s]))
+		}
+		if err := st.pc.Put(r[s]); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+func (st *planState) verify() error {
+	p := st.p
+	for n := range p.nodes {
+		node := &p.nodes[n]
+		if node.kind != planRep {
+			continue
+		}
+		if err := st.vc.Get(st.V[n]); err != nil {
+			return err
+		}
+		st.mp[n][0] = st.pval[node.P]
+		for i, b := range node.B {
+			st.mp[n][1+i] = st.pval[b]
+		}
+	}
+	if err := st.vc.PubRand(st.c); err != nil {
+		return err
+	}
+	return st.check(0, st.c)
+}
+
+// check verifies the responses of node n against challenge c.
+func (st *planState) check(n int, c kyber.Scalar) error {
+	p := st.p
+	node := &p.nodes[n]
+	switch node.kind {
+	case planOr:
+		ci := st.ci[n]
+		if len(ci) > 1 {
+			csum := st.sum.Zero()
+			for _, s := range ci {
+				if err := st.vc.Get(s); err != nil {
+					return err
+				}
+				csum.Add(csum, s)
+			}
+			if !csum.Equal(c) {
+				return errors.New("invalid proof: bad sub-challenges")
+			}
+		} else { // trivial single-sub OR
+			ci[0].Set(c)
+		}
+		for i, sub := range node.sub {
+			if err := st.check(sub, ci[i]); err != nil {
+				return err
+			}
+		}
+		return nil
+	}
+
+	if node.root {
+		r := st.r[node.domain]
+		for _, s := range p.domains[node.domain].used {
+			if err := st.vc.Get(r[s]); err != nil {
+				return err
+			}
+		}
+	}
+	if node.kind == planAnd {
+		for _, sub := range node.sub {
+			if err := st.check(sub, c); err != nil {
+				return err
+			}
+		}
+		return nil
+	}
+
+	// Rep: V == cP + r1B1 + ... + rkBk
+	st.ms[n][0] = c
+	if !msm.Sum(st.tmp, st.ms[n], st.mp[n]).Equal(st.V[n]) {
+		return errors.New("invalid proof: commit mismatch")
+	}
+	return nil
+}
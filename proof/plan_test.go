@@ -0,0 +1,171 @@
+// +build experimental
+
+package proof
+
+import (
+	"bytes"
+	"testing"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/group/edwards25519"
+	"github.com/dedis/kyber/xof/blake"
+)
+
+// planStatement builds the statement of TestRep: an OR of ANDs and Reps,
+// with trivial single-branch ORs, over the given suite.
+func planStatement(suite Suite) (Predicate, map[Predicate]int,
+	map[string]kyber.Scalar, map[string]kyber.Point) {
+	rand := blake.New([]byte("statement"))
+	x := suite.Scalar().Pick(rand)
+	y := suite.Scalar().Pick(rand)
+	B := suite.Point().Base()
+	X := suite.Point().Mul(x, nil)
+	Y := suite.Point().Mul(y, X)
+	R := suite.Point().Add(X, Y)
+
+	choice := make(map[Predicate]int)
+	and := And(Rep("X", "x", "B"), Rep("R", "x", "B", "y", "X"))
+	falseAnd := And(Rep("Y", "x", "B"), Rep("R", "x", "B", "y", "B"))
+	or1 := Or(falseAnd, And(and))
+	choice[or1] = 1
+	or1x := Or(or1)
+	choice[or1x] = 0
+	or2x := Or(Or(Rep("B", "y", "X"), Rep("R", "x", "R")))
+	pred := Or(or1x, or2x)
+	choice[pred] = 0
+
+	sval := map[string]kyber.Scalar{"x": x, "y": y}
+	pval := map[string]kyber.Point{"B": B, "X": X, "Y": Y, "R": R}
+	return pred, choice, sval, pval
+}
+
+// planSlots returns the values of the maps by slot of plan.
+func planSlots(plan *Plan, sval map[string]kyber.Scalar,
+	pval map[string]kyber.Point) ([]kyber.Scalar, []kyber.Point) {
+	var secrets []kyber.Scalar
+	for _, name := range plan.ScalarNames() {
+		secrets = append(secrets, sval[name])
+	}
+	var points []kyber.Point
+	for _, name := range plan.PointNames() {
+		points = append(points, pval[name])
+	}
+	return secrets, points
+}
+
+func TestPlan(t *testing.T) {
+	// Identically seeded suites, so that both paths draw the same
+	// blinding factors.
+	suite1 := edwards25519.NewBlakeSHA256Ed25519WithRand(blake.New([]byte("seed")))
+	suite2 := edwards25519.NewBlakeSHA256Ed25519WithRand(blake.New([]byte("seed")))
+	pred, choice, sval, pval := planStatement(suite1)
+
+	plan, err := Compile(suite2, pred)
+	if err != nil {
+		t.Fatal(err)
+	}
+	secrets, points := planSlots(plan, sval, pval)
+
+	proof1, err := HashProve(suite1, "TEST", pred.Prover(suite1, sval, pval, choice))
+	if err != nil {
+		t.Fatal("prover: " + err.Error())
+	}
+	proof2, err := HashProve(suite2, "TEST", plan.Prover(secrets, points, choice))
+	if err != nil {
+		t.Fatal("plan prover: " + err.Error())
+	}
+	if !bytes.Equal(proof1, proof2) {
+		t.Fatal("plan and predicate proofs differ")
+	}
+
+	// Each verifies the other's proofs, here repeatedly to reuse the
+	// pooled state.
+	for i := 0; i < 3; i++ {
+		if err := HashVerify(suite2, "TEST", plan.Verifier(points), proof1); err != nil {
+			t.Fatal("plan verify: " + err.Error())
+		}
+	}
+	proof2, err = HashProve(suite2, "TEST", plan.Prover(secrets, points, choice))
+	if err != nil {
+		t.Fatal("plan prover: " + err.Error())
+	}
+	if err := HashVerify(suite1, "TEST", pred.Verifier(suite1, pval), proof2); err != nil {
+		t.Fatal("verify: " + err.Error())
+	}
+
+	// A proof of another statement, or under another name, fails.
+	wrong := append([]kyber.Point(nil), points...)
+	wrong[plan.PointIndex("R")] = suite2.Point().Base()
+	if HashVerify(suite2, "TEST", plan.Verifier(wrong), proof2) == nil {
+		t.Fatal("plan verified a proof of another statement")
+	}
+	if HashVerify(suite2, "OTHER", plan.Verifier(points), proof2) == nil {
+		t.Fatal("plan verified a proof under another name")
+	}
+	if HashVerify(suite2, "TEST", plan.Verifier(points), proof2[:len(proof2)-1]) == nil {
+		t.Fatal("plan verified a truncated proof")
+	}
+
+	if plan.ScalarIndex("z") != -1 || plan.PointIndex("x") != -1 {
+		t.Fatal("unknown variables have slots")
+	}
+	if _, err := Compile(suite2, And(Or(Rep("X", "x", "B")))); err == nil {
+		t.Fatal("compiled an OR predicate within an AND predicate")
+	}
+}
+
+func benchmarkRepStatement() (Suite, Predicate, map[string]kyber.Scalar,
+	map[string]kyber.Point) {
+	suite := edwards25519.NewBlakeSHA256Ed25519WithRand(blake.New([]byte("seed")))
+	x := suite.Scalar().Pick(suite.RandomStream())
+	y := suite.Scalar().Pick(suite.RandomStream())
+	B := suite.Point().Base()
+	X := suite.Point().Mul(x, nil)
+	R := suite.Point().Add(suite.Point().Mul(x, nil), suite.Point().Mul(y, X))
+	pred := And(Rep("X", "x", "B"), Rep("R", "x", "B", "y", "X"))
+	sval := map[string]kyber.Scalar{"x": x, "y": y}
+	pval := map[string]kyber.Point{"B": B, "X": X, "R": R}
+	return suite, pred, sval, pval
+}
+
+func BenchmarkRepProve(b *testing.B) {
+	suite, pred, sval, pval := benchmarkRepStatement()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		HashProve(suite, "TEST", pred.Prover(suite, sval, pval, nil))
+	}
+}
+
+func BenchmarkRepVerify(b *testing.B) {
+	suite, pred, sval, pval := benchmarkRepStatement()
+	proof, _ := HashProve(suite, "TEST", pred.Prover(suite, sval, pval, nil))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		HashVerify(suite, "TEST", pred.Verifier(suite, pval), proof)
+	}
+}
+
+func BenchmarkPlanProve(b *testing.B) {
+	suite, pred, sval, pval := benchmarkRepStatement()
+	plan, _ := Compile(suite, pred)
+	secrets, points := planSlots(plan, sval, pval)
+	prover := plan.Prover(secrets, points, nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		HashProve(suite, "TEST", prover)
+	}
+}
+
+func BenchmarkPlanVerify(b *testing.B) {
+	suite, pred, sval, pval := benchmarkRepStatement()
+	plan, _ := Compile(suite, pred)
+	secrets, points := planSlots(plan, sval, pval)
+	proof, _ := HashProve(suite, "TEST", plan.Prover(secrets, points, nil))
+	verifier := plan.Verifier(points)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if err := HashVerify(suite, "TEST", verifier, proof); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
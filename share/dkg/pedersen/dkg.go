@@ -4,6 +4,8 @@ package dkg
 
 import (
 	"errors"
+	"runtime"
+	"sync"
 
 	"github.com/dedis/kyber"
 
@@ -67,6 +69,12 @@ type Justification struct {
 }
 
 // DistKeyGenerator is the struct that runs the DKG protocol.
+// It is safe for concurrent use: deals, responses and justifications
+// concerning different dealers are processed in parallel, and only the
+// messages about the same dealer are serialized. Concurrent processing
+// draws randomness from suite.RandomStream() in several goroutines, so it
+// requires a suite whose random stream is safe for concurrent use, such as
+// the default one from util/random.
 type DistKeyGenerator struct {
 	suite Suite
 
@@ -78,8 +86,18 @@ type DistKeyGenerator struct {
 
 	t int
 
-	dealer    *vss.Dealer
-	verifiers map[uint32]*vss.Verifier
+	dealerMu sync.Mutex // guards dealer
+	dealer   *vss.Dealer
+
+	mu        sync.RWMutex // guards the verifiers map, not its values
+	verifiers map[uint32]*dealVerifier
+}
+
+// dealVerifier is the verifier of the deal of one dealer, with its own
+// lock so that the state of different dealers can be updated concurrently.
+type dealVerifier struct {
+	sync.Mutex
+	*vss.Verifier
 }
 
 // NewDistKeyGenerator returns a DistKeyGenerator out of the suite,
@@ -111,7 +129,7 @@ func NewDistKeyGenerator(suite Suite, longterm kyber.Scalar, participants []kybe
 
 	return &DistKeyGenerator{
 		dealer:       dealer,
-		verifiers:    make(map[uint32]*vss.Verifier),
+		verifiers:    make(map[uint32]*dealVerifier),
 		t:            t,
 		suite:        suite,
 		long:         longterm,
@@ -135,7 +153,9 @@ func NewDistKeyGenerator(suite Suite, longterm kyber.Scalar, participants []kybe
 // sever problem with the configuration or implementation and
 // results in a panic.
 func (d *DistKeyGenerator) Deals() (map[int]*Deal, error) {
+	d.dealerMu.Lock()
 	deals, err := d.dealer.EncryptedDeals()
+	d.dealerMu.Unlock()
 	if err != nil {
 		return nil, err
 	}
@@ -146,7 +166,7 @@ func (d *DistKeyGenerator) Deals() (map[int]*Deal, error) {
 			Deal:  deals[i],
 		}
 		if i == int(d.index) {
-			if _, ok := d.verifiers[d.index]; ok {
+			if _, ok := d.verifier(d.index); ok {
 				// already processed our own deal
 				continue
 			}
@@ -173,8 +193,8 @@ func (d *DistKeyGenerator) ProcessDeal(dd *Deal) (*Response, error) {
 		return nil, errors.New("dkg: dist deal out of bounds index")
 	}
 
-	if _, ok := d.verifiers[dd.Index]; ok {
-		return nil, errors.New("dkg: already received dist deal from same index")
+	if _, ok := d.verifier(dd.Index); ok {
+		return nil, errDealReceived
 	}
 
 	// verifier receiving the dealer's deal
@@ -183,7 +203,19 @@ func (d *DistKeyGenerator) ProcessDeal(dd *Deal) (*Response, error) {
 		return nil, err
 	}
 
-	d.verifiers[dd.Index] = ver
+	// Register the verifier before processing the deal, locked, so that
+	// messages about this dealer wait until the deal is processed.
+	v := &dealVerifier{Verifier: ver}
+	v.Lock()
+	defer v.Unlock()
+	d.mu.Lock()
+	if _, ok := d.verifiers[dd.Index]; ok {
+		d.mu.Unlock()
+		return nil, errDealReceived
+	}
+	d.verifiers[dd.Index] = v
+	d.mu.Unlock()
+
 	resp, err := ver.ProcessEncryptedDeal(dd.Deal)
 	if err != nil {
 		return nil, err
@@ -191,7 +223,7 @@ func (d *DistKeyGenerator) ProcessDeal(dd *Deal) (*Response, error) {
 
 	// Set StatusApproval for the verifier that represents the participant
 	// that distibuted the Deal
-	d.verifiers[dd.Index].UnsafeSetResponseDKG(dd.Index, vss.StatusApproval)
+	ver.UnsafeSetResponseDKG(dd.Index, vss.StatusApproval)
 
 	return &Response{
 		Index:    dd.Index,
@@ -199,18 +231,56 @@ func (d *DistKeyGenerator) ProcessDeal(dd *Deal) (*Response, error) {
 	}, nil
 }
 
+var errDealReceived = errors.New("dkg: already received dist deal from same index")
+
+// ProcessDeals processes a list of deals in parallel, using all available
+// CPUs, as if ProcessDeal was called on each of them. It returns the
+// responses in the same order as the deals, and nil errors if all deals
+// were processed successfully; otherwise errs[i] is the error returned for
+// deals[i].
+func (d *DistKeyGenerator) ProcessDeals(deals []*Deal) (resps []*Response, errs []error) {
+	resps = make([]*Response, len(deals))
+	errs = make([]error, len(deals))
+	work := make(chan int)
+	var wg sync.WaitGroup
+	for w := 0; w < runtime.GOMAXPROCS(0); w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for i := range work {
+				resps[i], errs[i] = d.ProcessDeal(deals[i])
+			}
+		}()
+	}
+	for i := range deals {
+		work <- i
+	}
+	close(work)
+	wg.Wait()
+
+	for _, err := range errs {
+		if err != nil {
+			return resps, errs
+		}
+	}
+	return resps, nil
+}
+
 // ProcessResponse takes a response from every other peer.  If the response
 // designates the deal of another participant than this dkg, this dkg stores it
 // and returns nil with a possible error regarding the validity of the response.
 // If the response designates a deal this dkg has issued, then the dkg will process
 // the response, and returns a justification.
 func (d *DistKeyGenerator) ProcessResponse(resp *Response) (*Justification, error) {
-	v, ok := d.verifiers[resp.Index]
+	v, ok := d.verifier(resp.Index)
 	if !ok {
 		return nil, errors.New("dkg: complaint received but no deal for it")
 	}
 
-	if err := v.ProcessResponse(resp.Response); err != nil {
+	v.Lock()
+	err := v.ProcessResponse(resp.Response)
+	v.Unlock()
+	if err != nil {
 		return nil, err
 	}
 
@@ -218,7 +288,9 @@ func (d *DistKeyGenerator) ProcessResponse(resp *Response) (*Justification, erro
 		return nil, nil
 	}
 
+	d.dealerMu.Lock()
 	j, err := d.dealer.ProcessResponse(resp.Response)
+	d.dealerMu.Unlock()
 	if err != nil {
 		return nil, err
 	}
@@ -226,7 +298,10 @@ func (d *DistKeyGenerator) ProcessResponse(resp *Response) (*Justification, erro
 		return nil, nil
 	}
 	// a justification for our own deal, are we cheating !?
-	if err := v.ProcessJustification(j); err != nil {
+	v.Lock()
+	err = v.ProcessJustification(j)
+	v.Unlock()
+	if err != nil {
 		return nil, err
 	}
 
@@ -239,19 +314,42 @@ func (d *DistKeyGenerator) ProcessResponse(resp *Response) (*Justification, erro
 // ProcessJustification takes a justification and validates it. It returns an
 // error in case the justification is wrong.
 func (d *DistKeyGenerator) ProcessJustification(j *Justification) error {
-	v, ok := d.verifiers[j.Index]
+	v, ok := d.verifier(j.Index)
 	if !ok {
 		return errors.New("dkg: Justification received but no deal for it")
 	}
+	v.Lock()
+	defer v.Unlock()
 	return v.ProcessJustification(j.Justification)
 }
 
 // SetTimeout triggers the timeout on all verifiers, and thus makes sure
 // all verifiers have either responded, or have a StatusComplaint response.
 func (d *DistKeyGenerator) SetTimeout() {
-	for _, v := range d.verifiers {
+	for _, v := range d.snapshot() {
+		v.Lock()
 		v.SetTimeout()
+		v.Unlock()
+	}
+}
+
+// verifier returns the verifier of the deal of the given dealer.
+func (d *DistKeyGenerator) verifier(idx uint32) (*dealVerifier, bool) {
+	d.mu.RLock()
+	defer d.mu.RUnlock()
+	v, ok := d.verifiers[idx]
+	return v, ok
+}
+
+// snapshot returns the verifiers of all deals received so far.
+func (d *DistKeyGenerator) snapshot() map[uint32]*dealVerifier {
+	d.mu.RLock()
+	defer d.mu.RUnlock()
+	vs := make(map[uint32]*dealVerifier, len(d.verifiers))
+	for i, v := range d.verifiers {
+		vs[i] = v
 	}
+	return vs
 }
 
 // Certified returns true if at least t deals are certified (see
@@ -287,12 +385,15 @@ func (d *DistKeyGenerator) isInQUAL(idx uint32) bool {
 	return found
 }
 
+// qualIter calls fn on the certified deals, holding the lock of the
+// deal's verifier, until fn returns false.
 func (d *DistKeyGenerator) qualIter(fn func(idx uint32, v *vss.Verifier) bool) {
-	for i, v := range d.verifiers {
-		if v.DealCertified() {
-			if !fn(i, v) {
-				break
-			}
+	for i, v := range d.snapshot() {
+		v.Lock()
+		cont := !v.DealCertified() || fn(i, v.Verifier)
+		v.Unlock()
+		if !cont {
+			break
 		}
 	}
 }
@@ -310,7 +411,7 @@ func (d *DistKeyGenerator) DistKeyShare() (*DistKeyShare, error) {
 	}
 
 	sh := d.suite.Scalar().Zero()
-	var pub *share.PubPoly
+	var commits []kyber.Point
 	var err error
 
 	d.qualIter(func(i uint32, v *vss.Verifier) bool {
@@ -318,24 +419,15 @@ func (d *DistKeyGenerator) DistKeyShare() (*DistKeyShare, error) {
 		deal := v.Deal()
 		s := deal.SecShare.V
 		sh = sh.Add(sh, s)
-		// Dist. public key = sum of all revealed commitments
-		poly := share.NewPubPoly(d.suite, d.suite.Point().Base(), deal.Commitments)
-		if pub == nil {
-			// first polynomial we see (instead of generating n empty commits)
-			pub = poly
-			return true
-		}
-		pub, err = pub.Add(poly)
-		if err != nil {
-			return false
-		}
-		return true
+		// Dist. public key = sum of all revealed commitments, accumulated
+		// in place rather than in a new polynomial per dealer.
+		commits, err = share.AddCommits(d.suite, commits, deal.Commitments)
+		return err == nil
 	})
 
 	if err != nil {
 		return nil, err
 	}
-	_, commits := pub.Info()
 
 	return &DistKeyShare{
 		Commits: commits,
@@ -2,6 +2,7 @@ package dkg
 
 import (
 	"crypto/rand"
+	"sync"
 	"testing"
 
 	"github.com/dedis/kyber"
@@ -368,3 +369,60 @@ func fullExchange(t *testing.T) {
 	}
 
 }
+
+func TestDKGConcurrent(t *testing.T) {
+	dkgs = dkgGen()
+	// every participant processes its incoming deals as a batch
+	incoming := make([][]*Deal, nbParticipants)
+	for _, dkg := range dkgs {
+		deals, err := dkg.Deals()
+		require.Nil(t, err)
+		for i, d := range deals {
+			incoming[i] = append(incoming[i], d)
+		}
+	}
+	var resps []*Response
+	for i, dkg := range dkgs {
+		rs, errs := dkg.ProcessDeals(incoming[i])
+		require.Nil(t, errs)
+		for _, resp := range rs {
+			require.Equal(t, vss.StatusApproval, resp.Response.Status)
+		}
+		resps = append(resps, rs...)
+	}
+
+	// responses arrive concurrently
+	var wg sync.WaitGroup
+	for _, dkg := range dkgs {
+		for _, resp := range resps {
+			if resp.Response.Index == dkg.index {
+				continue
+			}
+			wg.Add(1)
+			go func(dkg *DistKeyGenerator, resp *Response) {
+				defer wg.Done()
+				j, err := dkg.ProcessResponse(resp)
+				assert.Nil(t, err)
+				assert.Nil(t, j)
+			}(dkg, resp)
+		}
+	}
+	wg.Wait()
+
+	dkss := make([]*DistKeyShare, nbParticipants)
+	for i, dkg := range dkgs {
+		require.True(t, dkg.Certified())
+		dks, err := dkg.DistKeyShare()
+		require.Nil(t, err)
+		dkss[i] = dks
+	}
+	for _, dks := range dkss {
+		assert.True(t, checkDks(dks, dkss[0]))
+	}
+
+	// deals cannot be processed twice, even concurrently
+	_, errs := dkgs[0].ProcessDeals([]*Deal{incoming[0][0], incoming[0][0]})
+	require.NotNil(t, errs)
+	assert.Error(t, errs[0])
+	assert.Error(t, errs[1])
+}
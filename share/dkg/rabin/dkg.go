@@ -618,35 +618,28 @@ func (d *DistKeyGenerator) DistKeyShare() (*DistKeyShare, error) {
 	}
 
 	sh := d.suite.Scalar().Zero()
-	var pub *share.PubPoly
+	var commits []kyber.Point
 	var err error
 
 	d.qualIter(func(i uint32, v *vss.Verifier) bool {
 		// share of dist. secret = sum of all share received.
 		s := v.Deal().SecShare.V
 		sh = sh.Add(sh, s)
-		// Dist. public key = sum of all revealed commitments
+		// Dist. public key = sum of all revealed commitments, accumulated
+		// in place rather than in a new polynomial per dealer.
 		poly, ok := d.commitments[i]
 		if !ok {
 			err = fmt.Errorf("dkg: protocol not finished: %d commitments missing", i)
 			return false
 		}
-		if pub == nil {
-			// first polynomial we see (instead of generating n empty commits)
-			pub = poly
-			return true
-		}
-		pub, err = pub.Add(poly)
-		if err != nil {
-			return false
-		}
-		return true
+		_, polyCommits := poly.Info()
+		commits, err = share.AddCommits(d.suite, commits, polyCommits)
+		return err == nil
 	})
 
 	if err != nil {
 		return nil, err
 	}
-	_, commits := pub.Info()
 
 	return &DistKeyShare{
 		Commits: commits,
@@ -662,8 +655,10 @@ func (sc *SecretCommits) Hash(s Suite) []byte {
 	h := s.Hash()
 	_, _ = h.Write([]byte("secretcommits"))
 	_ = binary.Write(h, binary.LittleEndian, sc.Index)
+	var buf []byte
 	for _, p := range sc.Commitments {
-		_, _ = p.MarshalTo(h)
+		buf, _ = p.AppendBinary(buf[:0])
+		_, _ = h.Write(buf)
 	}
 	return h.Sum(nil)
 }
@@ -235,12 +235,15 @@ func findPub(list []kyber.Point, i int) (kyber.Point, bool) {
 
 func sessionID(s Suite, a, b DistKeyShare) []byte {
 	h := s.Hash()
+	var buf []byte
 	for _, p := range a.Commitments() {
-		_, _ = p.MarshalTo(h)
+		buf, _ = p.AppendBinary(buf[:0])
+		_, _ = h.Write(buf)
 	}
 
 	for _, p := range b.Commitments() {
-		_, _ = p.MarshalTo(h)
+		buf, _ = p.AppendBinary(buf[:0])
+		_, _ = h.Write(buf)
 	}
 
 	return h.Sum(nil)
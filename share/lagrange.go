@@ -0,0 +1,127 @@
+package share
+
+import (
+	"errors"
+	"math"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/util/alloc"
+)
+
+// BatchInvert replaces every scalar of s by its modular inverse, using
+// Montgomery's trick: a single inversion and about 3*len(s) multiplications
+// instead of len(s) inversions. Zero scalars have no inverse and are left
+// unchanged; note that whether an entry is zero may leak through timing.
+func BatchInvert(s []kyber.Scalar) {
+	if len(s) == 0 {
+		return
+	}
+	zero := s[0].Clone().Zero()
+
+	// prefix[i] = s[0]*...*s[i-1], skipping zeros
+	prefix := make([]kyber.Scalar, len(s))
+	acc := s[0].Clone().One()
+	for i, x := range s {
+		prefix[i] = acc.Clone()
+		if !x.Equal(zero) {
+			acc.Mul(acc, x)
+		}
+	}
+
+	// acc = 1/(s[0]*...*s[i]) while walking backwards
+	acc.Inv(acc)
+	for i := len(s) - 1; i >= 0; i-- {
+		if s[i].Equal(zero) {
+			continue
+		}
+		prefix[i].Mul(acc, prefix[i]) // 1/s[i]
+		acc.Mul(acc, s[i])
+		s[i].Set(prefix[i])
+	}
+}
+
+// LagrangeBasis returns the Lagrange coefficients for interpolating the
+// constant term of a secret sharing polynomial from the shares with the
+// given indices: for shares with these indices, in this order,
+//
+//	p(0) = coeffs[0]*shares[0].V + ... + coeffs[t-1]*shares[t-1].V
+//
+// The coefficients only depend on the indices, so a quorum recovering
+// many secrets or commitments can compute them once and reuse them,
+// e.g. with msm.Sum for public shares. All it takes is a single scalar
+// inversion. LagrangeBasis returns an error if an index is negative or
+// appears twice.
+func LagrangeBasis(g kyber.Group, indices []int) ([]kyber.Scalar, error) {
+	x, err := xCoords(g, indices)
+	if err != nil {
+		return nil, err
+	}
+	// coeffs[j] = w[j] * prod_{m != j} (0 - x[m]), using running
+	// products of -x[m] from the left and from the right.
+	coeffs := lagrangeWeights(g, indices)
+	acc := g.Scalar().One()
+	minus := g.Scalar()
+	for j := range x {
+		coeffs[j].Mul(coeffs[j], acc)
+		acc.Mul(acc, minus.Neg(x[j]))
+	}
+	acc.One()
+	for j := len(x) - 1; j >= 0; j-- {
+		coeffs[j].Mul(coeffs[j], acc)
+		acc.Mul(acc, minus.Neg(x[j]))
+	}
+	return coeffs, nil
+}
+
+// xCoords returns the x-coordinates i+1 of the shares with the given
+// indices, checking that the indices are valid and distinct.
+func xCoords(g kyber.Group, indices []int) ([]kyber.Scalar, error) {
+	seen := make(map[int]bool, len(indices))
+	x := alloc.Scalars(g, len(indices))
+	for j, i := range indices {
+		if i < 0 {
+			return nil, errors.New("share: negative share index")
+		}
+		if seen[i] {
+			return nil, errors.New("share: duplicate share index")
+		}
+		seen[i] = true
+		x[j].SetInt64(1 + int64(i))
+	}
+	return x, nil
+}
+
+// lagrangeWeights returns the barycentric weights of the distinct
+// x-coordinates x[j] = indices[j]+1,
+// w[j] = 1 / prod_{m != j} (x[j] - x[m]), sharing a single inversion.
+// The differences are small integers, so they are multiplied as int64 as
+// long as the product cannot overflow, saving most scalar multiplications.
+func lagrangeWeights(g kyber.Group, indices []int) []kyber.Scalar {
+	w := alloc.Scalars(g, len(indices))
+	tmp := g.Scalar()
+	for j, ij := range indices {
+		w[j].One()
+		prod := int64(1)
+		for m, im := range indices {
+			if m == j {
+				continue
+			}
+			d := int64(ij) - int64(im)
+			if abs64(prod) > math.MaxInt64/abs64(d) {
+				w[j].Mul(w[j], tmp.SetInt64(prod))
+				prod = 1
+			}
+			prod *= d
+		}
+		w[j].Mul(w[j], tmp.SetInt64(prod))
+	}
+	BatchInvert(w)
+	return w
+}
+
+func abs64(v int64) int64 {
+	if v < 0 {
+		return -v
+	}
+	return v
+}
@@ -16,6 +16,9 @@ import (
 	"strings"
 
 	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/internal/parallel"
+	"github.com/dedis/kyber/util/alloc"
+	"github.com/dedis/kyber/util/msm"
 )
 
 // Suite defines the capabilities required by the share package.
@@ -53,13 +56,14 @@ type PriPoly struct {
 // suite, the secret sharing threshold t, and the secret to be shared s.
 // If s is nil, a new s is chosen using the suite's randomness stream.
 func NewPriPoly(suite Suite, t int, s kyber.Scalar) *PriPoly {
-	coeffs := make([]kyber.Scalar, t)
-	coeffs[0] = s
-	if coeffs[0] == nil {
-		coeffs[0] = suite.Scalar().Pick(suite.RandomStream())
+	coeffs := alloc.Scalars(suite, t)
+	if s != nil {
+		coeffs[0] = s
+	} else {
+		coeffs[0].Pick(suite.RandomStream())
 	}
 	for i := 1; i < t; i++ {
-		coeffs[i] = suite.Scalar().Pick(suite.RandomStream())
+		coeffs[i].Pick(suite.RandomStream())
 	}
 	return &PriPoly{s: suite, coeffs: coeffs}
 }
@@ -88,8 +92,18 @@ func (p *PriPoly) Eval(i int) *PriShare {
 // Shares creates a list of n private shares p(1),...,p(n).
 func (p *PriPoly) Shares(n int) []*PriShare {
 	shares := make([]*PriShare, n)
+	backing := make([]PriShare, n)
+	values := alloc.Scalars(p.s, n)
+	xi := p.s.Scalar()
 	for i := range shares {
-		shares[i] = p.Eval(i)
+		xi.SetInt64(1 + int64(i))
+		v := values[i].Zero()
+		for j := p.Threshold() - 1; j >= 0; j-- {
+			v.Mul(v, xi)
+			v.Add(v, p.coeffs[j])
+		}
+		backing[i] = PriShare{i, v}
+		shares[i] = &backing[i]
 	}
 	return shares
 }
@@ -103,9 +117,9 @@ func (p *PriPoly) Add(q *PriPoly) (*PriPoly, error) {
 	if p.Threshold() != q.Threshold() {
 		return nil, errorCoeffs
 	}
-	coeffs := make([]kyber.Scalar, p.Threshold())
+	coeffs := alloc.Scalars(p.s, p.Threshold())
 	for i := range coeffs {
-		coeffs[i] = p.s.Scalar().Add(p.coeffs[i], q.coeffs[i])
+		coeffs[i].Add(p.coeffs[i], q.coeffs[i])
 	}
 	return &PriPoly{p.s, coeffs}, nil
 }
@@ -131,13 +145,59 @@ func (p *PriPoly) Equal(q *PriPoly) bool {
 }
 
 // Commit creates a public commitment polynomial for the given base point b or
-// the standard base if b == nil.
+// the standard base if b == nil. The coefficients are committed in parallel,
+// with the fixed-base multiplication of the group for the standard base and,
+// for other bases, a precomputed table of multiples of b if the group
+// implements kyber.Precomputable.
 func (p *PriPoly) Commit(b kyber.Point) *PubPoly {
-	commits := make([]kyber.Point, p.Threshold())
-	for i := range commits {
-		commits[i] = p.s.Point().Mul(p.coeffs[i], b)
+	commits := alloc.Points(p.s, p.Threshold())
+	base := p.commitBase(b)
+	parallel.Range(len(commits), func(lo, hi int) {
+		for i := lo; i < hi; i++ {
+			commits[i].Mul(p.coeffs[i], base)
+		}
+	})
+	return NewPubPoly(p.s, b, commits)
+}
+
+// CommitPedersen creates the public commitment polynomial of the Pedersen
+// commitments p_i*B + q_i*h to the coefficients of p and q, for the standard
+// base B and a second base h, all in one parallel pass.
+func (p *PriPoly) CommitPedersen(q *PriPoly, h kyber.Point) (*PubPoly, error) {
+	if p.s.String() != q.s.String() {
+		return nil, errorGroups
 	}
-	return &PubPoly{p.s, b, commits}
+	if p.Threshold() != q.Threshold() {
+		return nil, errorCoeffs
+	}
+	commits := alloc.Points(p.s, p.Threshold())
+	hb := p.commitBase(h)
+	parallel.Range(len(commits), func(lo, hi int) {
+		tmp := p.s.Point()
+		for i := lo; i < hi; i++ {
+			commits[i].Mul(p.coeffs[i], nil)
+			commits[i].Add(commits[i], tmp.Mul(q.coeffs[i], hb))
+		}
+	})
+	return NewPubPoly(p.s, p.s.Point().Base(), commits), nil
+}
+
+// minPrecomputeCommits is the number of coefficients from which committing
+// to a base other than the standard one pays for precomputing its table.
+const minPrecomputeCommits = 5
+
+// commitBase returns the point to multiply the coefficients of p with for
+// commitments to b: nil for the standard base, or else b itself or a copy
+// of b carrying a precomputed table.
+func (p *PriPoly) commitBase(b kyber.Point) kyber.Point {
+	if b == nil || b.Equal(p.s.Point().Base()) {
+		return nil
+	}
+	if _, ok := b.(kyber.Precomputable); ok && len(p.coeffs) >= minPrecomputeCommits {
+		b = b.Clone()
+		b.(kyber.Precomputable).Precompute()
+	}
+	return b
 }
 
 // Mul multiples p  and q together. The result is a polynomial of the sum of
@@ -146,123 +206,181 @@ func (p *PriPoly) Commit(b kyber.Point) *PubPoly {
 // described above. This is only for use in secret sharing schemes. It is not
 // a general polynomial manipulation routine.
 func (p *PriPoly) Mul(q *PriPoly) *PriPoly {
-	d1 := len(p.coeffs) - 1
-	d2 := len(q.coeffs) - 1
-	newDegree := d1 + d2
-	coeffs := make([]kyber.Scalar, newDegree+1)
-	for i := range coeffs {
-		coeffs[i] = p.s.Scalar().Zero()
+	coeffs := zeroScalars(p.s, len(p.coeffs)+len(q.coeffs)-1)
+	polyMulAdd(p.s, coeffs, p.coeffs, q.coeffs)
+	return &PriPoly{p.s, coeffs}
+}
+
+// karatsubaThreshold is the length of the shorter factor below which
+// polyMulAdd multiplies by the schoolbook method.
+const karatsubaThreshold = 32
+
+func zeroScalars(g kyber.Group, n int) []kyber.Scalar {
+	z := alloc.Scalars(g, n)
+	for i := range z {
+		z[i].Zero()
 	}
-	for i := range p.coeffs {
-		for j := range q.coeffs {
-			tmp := p.s.Scalar().Mul(p.coeffs[i], q.coeffs[j])
-			coeffs[i+j] = tmp.Add(coeffs[i+j], tmp)
+	return z
+}
+
+// polyMulAdd adds the product of the polynomials with coefficients a and b
+// to z, which must have at least len(a)+len(b)-1 coefficients. Beyond
+// karatsubaThreshold it uses Karatsuba's method, in O(n^1.59) instead of
+// O(n^2) scalar multiplications.
+func polyMulAdd(g kyber.Group, z, a, b []kyber.Scalar) {
+	if len(a) > len(b) {
+		a, b = b, a
+	}
+	if len(a) == 0 {
+		return
+	}
+	if len(a) < karatsubaThreshold {
+		tmp := g.Scalar()
+		for i := range a {
+			for j := range b {
+				z[i+j].Add(z[i+j], tmp.Mul(a[i], b[j]))
+			}
 		}
+		return
+	}
+	n := len(a)
+	if len(b) > n {
+		// Multiply b by slices of the length of a.
+		for lo := 0; lo < len(b); lo += n {
+			hi := lo + n
+			if hi > len(b) {
+				hi = len(b)
+			}
+			polyMulAdd(g, z[lo:], a, b[lo:hi])
+		}
+		return
+	}
+
+	// a = a0 + x^h a1 and b = b0 + x^h b1, with a0*b0 = p0, a1*b1 = p2 and
+	// (a0+a1)*(b0+b1) = p0 + p1 + p2.
+	h := n / 2
+	p0 := zeroScalars(g, 2*h-1)
+	polyMulAdd(g, p0, a[:h], b[:h])
+	p2 := zeroScalars(g, 2*(n-h)-1)
+	polyMulAdd(g, p2, a[h:], b[h:])
+	sa, sb := alloc.Scalars(g, n-h), alloc.Scalars(g, n-h)
+	for i := range sa {
+		sa[i].Set(a[h+i])
+		sb[i].Set(b[h+i])
+		if i < h {
+			sa[i].Add(sa[i], a[i])
+			sb[i].Add(sb[i], b[i])
+		}
+	}
+	p1 := zeroScalars(g, 2*(n-h)-1)
+	polyMulAdd(g, p1, sa, sb)
+	for i := range p1 {
+		if i < len(p0) {
+			p1[i].Sub(p1[i], p0[i])
+		}
+		p1[i].Sub(p1[i], p2[i])
+	}
+	for i := range p0 {
+		z[i].Add(z[i], p0[i])
+	}
+	for i := range p1 {
+		z[h+i].Add(z[h+i], p1[i])
+	}
+	for i := range p2 {
+		z[2*h+i].Add(z[2*h+i], p2[i])
 	}
-	return &PriPoly{p.s, coeffs}
 }
 
 // RecoverSecret reconstructs the shared secret p(0) from a list of private
 // shares using Lagrange interpolation.
 func RecoverSecret(g kyber.Group, shares []*PriShare, t, n int) (kyber.Scalar, error) {
-	x := xScalar(g, shares, t, n)
-
-	if len(x) < t {
+	valid := validPriShares(shares, t, n)
+	if len(valid) < t {
 		return nil, errors.New("share: not enough shares to recover secret")
 	}
 
+	coeffs, err := LagrangeBasis(g, priShareIndices(valid))
+	if err != nil {
+		return nil, err
+	}
 	acc := g.Scalar().Zero()
-	num := g.Scalar()
-	den := g.Scalar()
 	tmp := g.Scalar()
-
-	for i, xi := range x {
-		num.Set(shares[i].V)
-		den.One()
-		for j, xj := range x {
-			if i == j {
-				continue
-			}
-			num.Mul(num, xj)
-			den.Mul(den, tmp.Sub(xj, xi))
-		}
-		acc.Add(acc, num.Div(num, den))
+	for j, s := range valid {
+		acc.Add(acc, tmp.Mul(coeffs[j], s.V))
 	}
-
 	return acc, nil
 }
 
-func xScalar(g kyber.Group, shares []*PriShare, t, n int) map[int]kyber.Scalar {
-	x := make(map[int]kyber.Scalar)
-	for i, s := range shares {
+// validPriShares returns the first t usable shares among shares.
+func validPriShares(shares []*PriShare, t, n int) []*PriShare {
+	valid := make([]*PriShare, 0, t)
+	for _, s := range shares {
 		if s == nil || s.V == nil || s.I < 0 || n <= s.I {
 			continue
 		}
-		x[i] = g.Scalar().SetInt64(1 + int64(s.I))
-		if len(x) == t {
+		valid = append(valid, s)
+		if len(valid) == t {
 			break
 		}
 	}
-	return x
+	return valid
 }
 
-func xMinusConst(s Suite, c kyber.Scalar) *PriPoly {
-	neg := s.Scalar().Neg(c)
-	return &PriPoly{
-		s:      s,
-		coeffs: []kyber.Scalar{neg, s.Scalar().One()},
+func priShareIndices(shares []*PriShare) []int {
+	indices := make([]int, len(shares))
+	for j, s := range shares {
+		indices[j] = s.I
 	}
+	return indices
 }
 
 // RecoverPriPoly takes a list of shares and the parameters t and n to
 // reconstruct the secret polynomial completely, i.e., all private coefficients.
 // It is up to the caller to make sure there are enough shares to correctly
 // re-construct the polynomial. There must be at least t shares.
+//
+// With the notations of https://en.wikipedia.org/wiki/Lagrange_polynomial,
+// the polynomial is the sum of y_j w_j l(x)/(x - x_j), where l is the
+// product of all (x - x_m). l is built once and each l(x)/(x - x_j)
+// follows by synthetic division, for O(t^2) scalar multiplications.
 func RecoverPriPoly(s Suite, shares []*PriShare, t, n int) (*PriPoly, error) {
-	x := xScalar(s, shares, t, n)
-	if len(x) != t {
+	valid := validPriShares(shares, t, n)
+	if len(valid) != t {
 		return nil, errors.New("share: not enough shares to recover private polynomial")
 	}
-
-	var accPoly *PriPoly
-	var err error
-	den := s.Scalar()
-	// notations following the wikipedia article on Lagrange interpolation
-	// https://en.wikipedia.org/wiki/Lagrange_polynomial
-	for j, xj := range x {
-		var basis = &PriPoly{
-			s:      s,
-			coeffs: []kyber.Scalar{s.Scalar().One()},
-		}
-		var acc = s.Scalar().Set(shares[j].V)
-		// compute lagrange basis l_j
-		for m, xm := range x {
-			if j == m {
-				continue
-			}
-			basis = basis.Mul(xMinusConst(s, xm)) // basis = basis * (x - xm)
-
-			den.Sub(xj, xm)   // den = xj - xm
-			den.Inv(den)      // den = 1 / den
-			acc.Mul(acc, den) // acc = acc * den
-		}
-
-		for i := range basis.coeffs {
-			basis.coeffs[i] = basis.coeffs[i].Mul(basis.coeffs[i], acc)
-		}
-
-		if accPoly == nil {
-			accPoly = basis
-			continue
+	indices := priShareIndices(valid)
+	x, err := xCoords(s, indices)
+	if err != nil {
+		return nil, err
+	}
+	// w[j] = 1 / prod_{m != j} (xj - xm)
+	w := lagrangeWeights(s, indices)
+
+	// l = prod_m (x - xm), of degree t
+	l := zeroScalars(s, t+1)
+	l[0].One()
+	tmp := s.Scalar()
+	for m, xm := range x {
+		// multiply the m+1 coefficients so far by (x - xm)
+		for k := m + 1; k > 0; k-- {
+			l[k].Sub(l[k-1], tmp.Mul(xm, l[k]))
 		}
+		l[0].Mul(l[0], tmp.Neg(xm))
+	}
 
-		// add all L_j * y_j together
-		accPoly, err = accPoly.Add(basis)
-		if err != nil {
-			return nil, err
+	coeffs := zeroScalars(s, t)
+	q := s.Scalar()
+	for j, xj := range x {
+		yw := w[j].Mul(w[j], valid[j].V) // yj * wj
+		// coefficients of l / (x - xj), from the highest down
+		q.Set(l[t])
+		coeffs[t-1].Add(coeffs[t-1], tmp.Mul(q, yw))
+		for k := t - 1; k > 0; k-- {
+			q.Add(l[k], q.Mul(q, xj))
+			coeffs[k-1].Add(coeffs[k-1], tmp.Mul(q, yw))
 		}
 	}
-	return accPoly, nil
+	return &PriPoly{s, coeffs}, nil
 }
 
 func (p *PriPoly) String() string {
@@ -292,11 +410,12 @@ type PubPoly struct {
 	g       kyber.Group   // Cryptographic group
 	b       kyber.Point   // Base point, nil for standard base
 	commits []kyber.Point // Commitments to coefficients of the secret sharing polynomial
+	scratch *alloc.Pool   // Scratch scalars for the evaluations
 }
 
 // NewPubPoly creates a new public commitment polynomial.
 func NewPubPoly(g kyber.Group, b kyber.Point, commits []kyber.Point) *PubPoly {
-	return &PubPoly{g, b, commits}
+	return &PubPoly{g, b, commits, alloc.NewPool(g)}
 }
 
 // Info returns the base point and the commitments to the polynomial coefficients.
@@ -316,20 +435,75 @@ func (p *PubPoly) Commit() kyber.Point {
 
 // Eval computes the public share v = p(i).
 func (p *PubPoly) Eval(i int) *PubShare {
-	xi := p.g.Scalar().SetInt64(1 + int64(i)) // x-coordinate of this share
-	v := p.g.Point().Null()
-	for j := p.Threshold() - 1; j >= 0; j-- {
-		v.Mul(xi, v)
-		v.Add(v, p.commits[j])
-	}
+	sc := p.scratch.Get()
+	v := p.eval(p.g.Point(), i, sc.Scalars(p.Threshold()+1))
+	p.scratch.Put(sc)
 	return &PubShare{i, v}
 }
 
+// eval sets v = p(i) using the t+1 scalars of tmp as scratch space for the
+// x-coordinate of share i and its powers, and returns it.
+func (p *PubPoly) eval(v kyber.Point, i int, tmp []kyber.Scalar) kyber.Point {
+	powers, xi := tmp[:len(tmp)-1], tmp[len(tmp)-1]
+	xi.SetInt64(1 + int64(i)) // x-coordinate of this share
+	for j := range powers {
+		if j == 0 {
+			powers[j].One()
+		} else {
+			powers[j].Mul(powers[j-1], xi)
+		}
+	}
+	return msm.Sum(v, powers, p.commits)
+}
+
 // Shares creates a list of n public commitment shares p(1),...,p(n).
+// The first t shares are evaluated in parallel, as multi-scalar
+// multiplications of the commitments. The remaining ones follow from them
+// by finite differences, for t-1 point additions each.
 func (p *PubPoly) Shares(n int) []*PubShare {
 	shares := make([]*PubShare, n)
+	backing := make([]PubShare, n)
+	values := alloc.Points(p.g, n)
 	for i := range shares {
-		shares[i] = p.Eval(i)
+		backing[i] = PubShare{i, values[i]}
+		shares[i] = &backing[i]
+	}
+	t := p.Threshold()
+	direct := n
+	if t >= 2 && t < n {
+		direct = t
+	}
+	parallel.Range(direct, func(lo, hi int) {
+		sc := p.scratch.Get()
+		tmp := sc.Scalars(t + 1)
+		for i := lo; i < hi; i++ {
+			p.eval(values[i], i, tmp)
+		}
+		p.scratch.Put(sc)
+	})
+	if direct == n {
+		return shares
+	}
+
+	// d[k] = backward difference of order k of the shares at share t-1.
+	// The values of a polynomial of degree t-1 at consecutive points have
+	// constant differences of order t-1.
+	d := alloc.Points(p.g, t)
+	for k := range d {
+		d[k].Set(shares[t-1-k].V)
+	}
+	tmp := p.g.Point()
+	for k := 1; k < t; k++ {
+		for j := t - 1; j >= k; j-- {
+			tmp.Sub(d[j-1], d[j])
+			d[j], tmp = tmp, d[j]
+		}
+	}
+	for i := t; i < n; i++ {
+		for k := t - 2; k >= 0; k-- {
+			d[k].Add(d[k], d[k+1])
+		}
+		values[i].Set(d[0])
 	}
 	return shares
 }
@@ -349,12 +523,35 @@ func (p *PubPoly) Add(q *PubPoly) (*PubPoly, error) {
 		return nil, errorCoeffs
 	}
 
-	commits := make([]kyber.Point, p.Threshold())
+	commits := alloc.Points(p.g, p.Threshold())
 	for i := range commits {
-		commits[i] = p.g.Point().Add(p.commits[i], q.commits[i])
+		commits[i].Add(p.commits[i], q.commits[i])
 	}
 
-	return &PubPoly{p.g, p.b, commits}, nil
+	return NewPubPoly(p.g, p.b, commits), nil
+}
+
+// AddCommits adds commits, the commitments of a polynomial, to sum
+// component-wise in place, as PubPoly.Add does without allocating a new
+// polynomial, and returns sum. If sum is nil, it returns a copy of commits
+// in new points of g, so that the commitments of many polynomials can be
+// accumulated as in
+//	sum, err = share.AddCommits(g, sum, commits)
+func AddCommits(g kyber.Group, sum, commits []kyber.Point) ([]kyber.Point, error) {
+	if sum == nil {
+		sum = alloc.Points(g, len(commits))
+		for i := range commits {
+			sum[i].Set(commits[i])
+		}
+		return sum, nil
+	}
+	if len(commits) != len(sum) {
+		return nil, errorCoeffs
+	}
+	for i := range commits {
+		sum[i].Add(sum[i], commits[i])
+	}
+	return sum, nil
 }
 
 // Equal checks equality of two public commitment polynomials p and
@@ -367,9 +564,10 @@ func (p *PubPoly) Equal(q *PubPoly) bool {
 		return false
 	}
 	b := 1
+	var pb, qb []byte
 	for i := 0; i < p.Threshold(); i++ {
-		pb, _ := p.commits[i].MarshalBinary()
-		qb, _ := q.commits[i].MarshalBinary()
+		pb, _ = p.commits[i].AppendBinary(pb[:0])
+		qb, _ = q.commits[i].AppendBinary(qb[:0])
 		b &= subtle.ConstantTimeCompare(pb, qb)
 	}
 	return b == 1
@@ -385,37 +583,23 @@ func (p *PubPoly) Check(s *PriShare) bool {
 // RecoverCommit reconstructs the secret commitment p(0) from a list of public
 // shares using Lagrange interpolation.
 func RecoverCommit(g kyber.Group, shares []*PubShare, t, n int) (kyber.Point, error) {
-	x := make(map[int]kyber.Scalar)
-	for i, s := range shares {
+	var indices []int
+	var points []kyber.Point
+	for _, s := range shares {
 		if s == nil || s.V == nil || s.I < 0 || n <= s.I {
 			continue
 		}
-		x[i] = g.Scalar().SetInt64(1 + int64(s.I))
+		indices = append(indices, s.I)
+		points = append(points, s.V)
 	}
 
-	if len(x) < t {
+	if len(indices) < t {
 		return nil, errors.New("share: not enough good public shares to reconstruct secret commitment")
 	}
 
-	num := g.Scalar()
-	den := g.Scalar()
-	tmp := g.Scalar()
-	Acc := g.Point().Null()
-	Tmp := g.Point()
-
-	for i, xi := range x {
-		num.One()
-		den.One()
-		for j, xj := range x {
-			if i == j {
-				continue
-			}
-			num.Mul(num, xj)
-			den.Mul(den, tmp.Sub(xj, xi))
-		}
-		Tmp.Mul(num.Div(num, den), shares[i].V)
-		Acc.Add(Acc, Tmp)
+	coeffs, err := LagrangeBasis(g, indices)
+	if err != nil {
+		return nil, err
 	}
-
-	return Acc, nil
+	return msm.Sum(g.Point(), coeffs, points), nil
 }
@@ -3,7 +3,10 @@ package share
 import (
 	"testing"
 
+	"github.com/dedis/kyber"
 	"github.com/dedis/kyber/group/edwards25519"
+	"github.com/dedis/kyber/suites"
+	"github.com/dedis/kyber/util/msm"
 	"github.com/stretchr/testify/assert"
 )
 
@@ -226,6 +229,51 @@ func TestPublicAdd(test *testing.T) {
 	}
 }
 
+func TestAddCommits(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	t := 6
+	P := NewPriPoly(g, t, nil).Commit(nil)
+	Q := NewPriPoly(g, t, nil).Commit(nil)
+	R, _ := P.Add(Q)
+
+	_, pc := P.Info()
+	_, qc := Q.Info()
+	pc0 := pc[0].Clone()
+	sum, err := AddCommits(g, nil, pc)
+	assert.Nil(test, err)
+	sum, err = AddCommits(g, sum, qc)
+	assert.Nil(test, err)
+	assert.True(test, R.Equal(NewPubPoly(g, nil, sum)))
+	// The first commitments were copied, not added to.
+	assert.True(test, pc[0].Equal(pc0))
+
+	_, err = AddCommits(g, sum, qc[1:])
+	assert.Error(test, err)
+}
+
+func TestPriPolyCommitBases(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	H := g.Point().Pick(g.RandomStream())
+	for _, t := range []int{3, 20} {
+		p := NewPriPoly(g, t, nil)
+		q := NewPriPoly(g, t, nil)
+		for _, b := range []kyber.Point{nil, g.Point().Base(), H} {
+			P := p.Commit(b)
+			for i, c := range P.commits {
+				assert.True(test, c.Equal(g.Point().Mul(p.coeffs[i], b)))
+			}
+			assert.True(test, P.b == b)
+		}
+
+		C, err := p.CommitPedersen(q, H)
+		assert.Nil(test, err)
+		F, _ := p.Commit(nil).Add(q.Commit(H))
+		assert.True(test, C.Equal(F))
+		_, err = p.CommitPedersen(NewPriPoly(g, t+1, nil), H)
+		assert.Error(test, err)
+	}
+}
+
 func TestPublicPolyEqual(test *testing.T) {
 	g := edwards25519.NewBlakeSHA256Ed25519()
 	n := 10
@@ -279,6 +327,24 @@ func TestPriPolyMul(test *testing.T) {
 	assert.Equal(test, ct.String(), mul.String())
 }
 
+func TestPriPolyMulKaratsuba(test *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	for _, c := range []struct{ ta, tb int }{{40, 40}, {70, 33}, {33, 150}, {64, 5}} {
+		a := NewPriPoly(suite, c.ta, nil)
+		b := NewPriPoly(suite, c.tb, nil)
+		got := a.Mul(b)
+
+		want := zeroScalars(suite, c.ta+c.tb-1)
+		tmp := suite.Scalar()
+		for i := range a.coeffs {
+			for j := range b.coeffs {
+				want[i+j].Add(want[i+j], tmp.Mul(a.coeffs[i], b.coeffs[j]))
+			}
+		}
+		assert.True(test, got.Equal(&PriPoly{suite, want}), "ta, tb = ", c.ta, c.tb)
+	}
+}
+
 func TestRecoverPriPoly(test *testing.T) {
 	suite := edwards25519.NewBlakeSHA256Ed25519()
 	n := 10
@@ -302,3 +368,169 @@ func TestRecoverPriPoly(test *testing.T) {
 		assert.Equal(test, reverseRecovered.Eval(i).V.String(), a.Eval(i).V.String())
 	}
 }
+
+func TestRecoverPriPolyLarge(test *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	n, t := 200, 150
+	a := NewPriPoly(suite, t, nil)
+	shares := a.Shares(n)
+	recovered, err := RecoverPriPoly(suite, shares[n-t:], t, n)
+	assert.Nil(test, err)
+	assert.True(test, recovered.Equal(a))
+
+	recovered, err = RecoverPriPoly(suite, shares[:1], 1, n)
+	assert.Nil(test, err)
+	assert.True(test, recovered.Secret().Equal(shares[0].V))
+}
+
+func TestBatchInvert(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	s := make([]kyber.Scalar, 10)
+	want := make([]kyber.Scalar, len(s))
+	for i := range s {
+		s[i] = g.Scalar().Pick(g.RandomStream())
+		if i%4 == 1 {
+			s[i].Zero()
+		}
+		want[i] = g.Scalar().Inv(s[i])
+	}
+	BatchInvert(s)
+	for i := range s {
+		assert.True(test, s[i].Equal(want[i]), "i = ", i)
+	}
+	BatchInvert(nil)
+}
+
+func TestLagrangeBasis(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	n := 10
+	t := n/2 + 1
+	indices := []int{7, 2, 9, 0, 4, 5}
+	coeffs, err := LagrangeBasis(g, indices)
+	assert.Nil(test, err)
+
+	// The same basis recovers any secret shared among the same quorum.
+	for k := 0; k < 3; k++ {
+		poly := NewPriPoly(g, t, nil)
+		pub := poly.Commit(nil)
+		secret := g.Scalar().Zero()
+		points := make([]kyber.Point, len(indices))
+		tmp := g.Scalar()
+		for j, i := range indices {
+			secret.Add(secret, tmp.Mul(coeffs[j], poly.Eval(i).V))
+			points[j] = pub.Eval(i).V
+		}
+		assert.True(test, secret.Equal(poly.Secret()))
+		assert.True(test, msm.Sum(g.Point(), coeffs, points).Equal(pub.Commit()))
+	}
+
+	_, err = LagrangeBasis(g, []int{1, 3, 1})
+	assert.Error(test, err)
+	_, err = LagrangeBasis(g, []int{1, -3})
+	assert.Error(test, err)
+}
+
+func BenchmarkRecoverSecret(b *testing.B) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	n := 1000
+	t := 700
+	shares := NewPriPoly(g, t, nil).Shares(n)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_, _ = RecoverSecret(g, shares, t, n)
+	}
+}
+
+func benchmarkRecoverPriPoly(b *testing.B, n, t int) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	shares := NewPriPoly(g, t, nil).Shares(n)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_, _ = RecoverPriPoly(g, shares, t, n)
+	}
+}
+
+func BenchmarkRecoverPriPoly100(b *testing.B)  { benchmarkRecoverPriPoly(b, 100, 51) }
+func BenchmarkRecoverPriPoly1000(b *testing.B) { benchmarkRecoverPriPoly(b, 1000, 667) }
+
+func benchmarkPriPolyMul(b *testing.B, t int) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	p, q := NewPriPoly(g, t, nil), NewPriPoly(g, t, nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		p.Mul(q)
+	}
+}
+
+func benchmarkPriPolyCommit(b *testing.B, t int, base bool) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	p := NewPriPoly(g, t, nil)
+	H := g.Point().Base()
+	if !base {
+		H.Pick(g.RandomStream())
+	}
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		p.Commit(H)
+	}
+}
+
+func BenchmarkPriPolyCommitBase334(b *testing.B) { benchmarkPriPolyCommit(b, 334, true) }
+func BenchmarkPriPolyCommitH334(b *testing.B)    { benchmarkPriPolyCommit(b, 334, false) }
+func BenchmarkPriPolyCommitH5(b *testing.B)      { benchmarkPriPolyCommit(b, 5, false) }
+
+func BenchmarkPriPolyMul100(b *testing.B)  { benchmarkPriPolyMul(b, 100) }
+func BenchmarkPriPolyMul1000(b *testing.B) { benchmarkPriPolyMul(b, 1000) }
+
+func TestPublicShares(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	for _, c := range []struct{ n, t int }{{30, 7}, {5, 7}, {10, 1}, {10, 10}, {11, 10}} {
+		pub := NewPriPoly(g, c.t, nil).Commit(nil)
+		shares := pub.Shares(c.n)
+		assert.Equal(test, c.n, len(shares))
+		for i, s := range shares {
+			assert.Equal(test, i, s.I)
+			assert.True(test, s.V.Equal(pub.Eval(i).V), "n, t, i = ", c.n, c.t, i)
+		}
+	}
+}
+
+func TestPolyAllocs(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	pri := NewPriPoly(g, 50, nil)
+	pub := pri.Commit(nil)
+
+	// Shares are allocated together, whatever their number.
+	small := testing.AllocsPerRun(10, func() { pri.Shares(10) })
+	large := testing.AllocsPerRun(10, func() { pri.Shares(100) })
+	assert.Equal(test, small, large)
+
+	// Evaluations reuse pooled scratch scalars for the powers.
+	pub.Eval(0)
+	allocs := testing.AllocsPerRun(10, func() { pub.Eval(3) })
+	assert.True(test, allocs < float64(pub.Threshold()), "allocs per Eval:", allocs)
+}
+
+func TestPublicSharesAllSuites(test *testing.T) {
+	for _, g := range suites.All() {
+		for _, c := range []struct{ n, t int }{{16, 9}, {12, 3}} {
+			pub := NewPriPoly(g, c.t, nil).Commit(nil)
+			shares := pub.Shares(c.n)
+			for i, s := range shares {
+				assert.True(test, s.V.Equal(pub.Eval(i).V), g.String(), "n, t, i = ", c.n, c.t, i)
+			}
+		}
+	}
+}
+
+func benchmarkPublicShares(b *testing.B, n, t int) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	pub := NewPriPoly(g, t, nil).Commit(nil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		pub.Shares(n)
+	}
+}
+
+func BenchmarkPublicShares100(b *testing.B)  { benchmarkPublicShares(b, 100, 51) }
+func BenchmarkPublicShares1000(b *testing.B) { benchmarkPublicShares(b, 1000, 334) }
@@ -16,6 +16,7 @@ import (
 	"errors"
 
 	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/internal/parallel"
 	"github.com/dedis/kyber/proof/dleq"
 	"github.com/dedis/kyber/share"
 )
@@ -35,6 +36,7 @@ var errorTooFewShares = errors.New("not enough shares to recover secret")
 var errorDifferentLengths = errors.New("inputs of different lengths")
 var errorEncVerification = errors.New("verification of encrypted share failed")
 var errorDecVerification = errors.New("verification of decrypted share failed")
+var errorSubgroup = errors.New("point outside of the prime-order subgroup")
 
 // PubVerShare is a public verifiable share.
 type PubVerShare struct {
@@ -45,7 +47,9 @@ type PubVerShare struct {
 // EncShares creates a list of encrypted publicly verifiable PVSS shares for
 // the given secret and the list of public keys X using the sharing threshold
 // t and the base point H. The function returns the list of shares and the
-// public commitment polynomial.
+// public commitment polynomial. Since H is used for every commitment, callers
+// reusing it across runs benefit from precomputing it if the group
+// implements kyber.Precomputable.
 func EncShares(suite Suite, H kyber.Point, X []kyber.Point, secret kyber.Scalar, t int) (shares []*PubVerShare, commit *share.PubPoly, err error) {
 	n := len(X)
 	encShares := make([]*PubVerShare, n)
@@ -86,7 +90,13 @@ func EncShares(suite Suite, H kyber.Point, X []kyber.Point, secret kyber.Scalar,
 // VerifyEncShare checks that the encrypted share sX satisfies
 // log_{H}(sH) == log_{X}(sX) where sH is the public commitment computed by
 // evaluating the public commitment polynomial at the encrypted share's index i.
+// In groups with a cofactor, the share and the commitments of its proof must
+// also lie in the prime-order subgroup, so that no share can be shifted by a
+// small-order point.
 func VerifyEncShare(suite Suite, H kyber.Point, X kyber.Point, sH kyber.Point, encShare *PubVerShare) error {
+	if !inSubgroup(encShare.S.V, encShare.P.VG, encShare.P.VH) {
+		return errorEncVerification
+	}
 	if err := encShare.P.Verify(suite, H, X, sH, encShare.S.V); err != nil {
 		return errorEncVerification
 	}
@@ -95,15 +105,19 @@ func VerifyEncShare(suite Suite, H kyber.Point, X kyber.Point, sH kyber.Point, e
 
 // VerifyEncShareBatch provides the same functionality as VerifyEncShare but for
 // slices of encrypted shares. The function returns the valid encrypted shares
-// together with the corresponding public keys.
+// together with the corresponding public keys. After the same subgroup checks
+// as in VerifyEncShare, all proofs are checked at once using dleq.VerifyBatch,
+// which only needs to examine the proofs individually if some of them are
+// invalid.
 func VerifyEncShareBatch(suite Suite, H kyber.Point, X []kyber.Point, sH []kyber.Point, encShares []*PubVerShare) ([]kyber.Point, []*PubVerShare, error) {
 	if len(X) != len(sH) || len(sH) != len(encShares) {
 		return nil, nil, errorDifferentLengths
 	}
+	errs := verifyEncShares(suite, H, X, sH, encShares)
 	var K []kyber.Point  // good public keys
 	var E []*PubVerShare // good encrypted shares
 	for i := 0; i < len(X); i++ {
-		if err := VerifyEncShare(suite, H, X[i], sH[i], encShares[i]); err == nil {
+		if errs == nil || errs[i] == nil {
 			K = append(K, X[i])
 			E = append(E, encShares[i])
 		}
@@ -111,6 +125,83 @@ func VerifyEncShareBatch(suite Suite, H kyber.Point, X []kyber.Point, sH []kyber
 	return K, E, nil
 }
 
+// verifyEncShares batch verifies the encryption consistency proofs of the
+// given encrypted shares, with the result of verifyBatch.
+func verifyEncShares(suite Suite, H kyber.Point, X []kyber.Point, sH []kyber.Point, encShares []*PubVerShare) []error {
+	n := len(encShares)
+	HS := make([]kyber.Point, n)
+	sX := make([]kyber.Point, n)
+	proofs := make([]*dleq.Proof, n)
+	for i, es := range encShares {
+		HS[i] = H
+		sX[i] = es.S.V
+		proofs[i] = &es.P
+	}
+	return verifyBatch(suite, HS, X, sH, sX, proofs, func(i int) bool {
+		es := encShares[i]
+		return inSubgroup(es.S.V, es.P.VG, es.P.VH)
+	})
+}
+
+// verifyBatch checks the dlog-equality proofs[i] for the points G[i], H[i],
+// xG[i] and xH[i] with dleq.VerifyBatch, after rejecting the proofs for which
+// valid(i), the subgroup check of the points supplied by the prover, fails.
+// dleq.VerifyBatch only compares up to small-order components, but with all
+// points in the prime-order subgroup, including the bases and public keys
+// of the caller, its verdict is the one of dleq.Proof.Verify. It returns nil
+// if all proofs are valid, and one error per proof otherwise.
+func verifyBatch(suite Suite, G, H, xG, xH []kyber.Point, proofs []*dleq.Proof, valid func(i int) bool) []error {
+	n := len(proofs)
+	ok := make([]bool, n)
+	parallel.Range(n, func(lo, hi int) {
+		for i := lo; i < hi; i++ {
+			ok[i] = valid(i)
+		}
+	})
+	var idx []int
+	for i := range ok {
+		if ok[i] {
+			idx = append(idx, i)
+		}
+	}
+	if len(idx) == n {
+		return dleq.VerifyBatch(suite, G, H, xG, xH, proofs)
+	}
+
+	bG := make([]kyber.Point, len(idx))
+	bH := make([]kyber.Point, len(idx))
+	bxG := make([]kyber.Point, len(idx))
+	bxH := make([]kyber.Point, len(idx))
+	bProofs := make([]*dleq.Proof, len(idx))
+	for j, i := range idx {
+		bG[j], bH[j], bxG[j], bxH[j], bProofs[j] = G[i], H[i], xG[i], xH[i], proofs[i]
+	}
+	bErrs := dleq.VerifyBatch(suite, bG, bH, bxG, bxH, bProofs)
+	errs := make([]error, n)
+	for i := range ok {
+		if !ok[i] {
+			errs[i] = errorSubgroup
+		}
+	}
+	for j, i := range idx {
+		if bErrs != nil {
+			errs[i] = bErrs[j]
+		}
+	}
+	return errs
+}
+
+// inSubgroup reports whether the points lie in the prime-order subgroup of
+// their group, which always holds in groups of prime order.
+func inSubgroup(points ...kyber.Point) bool {
+	for _, P := range points {
+		if c, ok := P.(kyber.SubgroupCheckable); ok && !c.InPrimeOrderSubgroup() {
+			return false
+		}
+	}
+	return true
+}
+
 // DecShare first verifies the encrypted share against the encryption
 // consistency proof and, if valid, decrypts it and creates a decryption
 // consistency proof.
@@ -118,6 +209,12 @@ func DecShare(suite Suite, H kyber.Point, X kyber.Point, sH kyber.Point, x kyber
 	if err := VerifyEncShare(suite, H, X, sH, encShare); err != nil {
 		return nil, err
 	}
+	return decShare(suite, x, encShare)
+}
+
+// decShare decrypts an encrypted share which has already been verified and
+// creates its decryption consistency proof.
+func decShare(suite Suite, x kyber.Scalar, encShare *PubVerShare) (*PubVerShare, error) {
 	G := suite.Point().Base()
 	V := suite.Point().Mul(suite.Scalar().Inv(x), encShare.S.V) // decryption: x^{-1} * (xS)
 	ps := &share.PubShare{I: encShare.S.I, V: V}
@@ -130,7 +227,8 @@ func DecShare(suite Suite, H kyber.Point, X kyber.Point, sH kyber.Point, x kyber
 
 // DecShareBatch provides the same functionality as DecShare but for slices of
 // encrypted shares. The function returns the valid encrypted and decrypted
-// shares as well as the corresponding public keys.
+// shares as well as the corresponding public keys. The encrypted shares are
+// verified all at once as in VerifyEncShareBatch.
 func DecShareBatch(suite Suite, H kyber.Point, X []kyber.Point, sH []kyber.Point, x kyber.Scalar, encShares []*PubVerShare) ([]kyber.Point, []*PubVerShare, []*PubVerShare, error) {
 	if len(X) != len(sH) || len(sH) != len(encShares) {
 		return nil, nil, nil, errorDifferentLengths
@@ -138,8 +236,12 @@ func DecShareBatch(suite Suite, H kyber.Point, X []kyber.Point, sH []kyber.Point
 	var K []kyber.Point  // good public keys
 	var E []*PubVerShare // good encrypted shares
 	var D []*PubVerShare // good decrypted shares
+	errs := verifyEncShares(suite, H, X, sH, encShares)
 	for i := 0; i < len(encShares); i++ {
-		if ds, err := DecShare(suite, H, X[i], sH[i], x, encShares[i]); err == nil {
+		if errs != nil && errs[i] != nil {
+			continue
+		}
+		if ds, err := decShare(suite, x, encShares[i]); err == nil {
 			K = append(K, X[i])
 			E = append(E, encShares[i])
 			D = append(D, ds)
@@ -150,7 +252,13 @@ func DecShareBatch(suite Suite, H kyber.Point, X []kyber.Point, sH []kyber.Point
 
 // VerifyDecShare checks that the decrypted share sG satisfies
 // log_{G}(X) == log_{sG}(sX). Note that X = xG and sX = s(xG) = x(sG).
+// As in VerifyEncShare, the shares and the commitments of the proof must
+// lie in the prime-order subgroup, so that the recovered secret cannot
+// depend on which shares are used.
 func VerifyDecShare(suite Suite, G kyber.Point, X kyber.Point, encShare *PubVerShare, decShare *PubVerShare) error {
+	if !inSubgroup(decShare.S.V, decShare.P.VG, decShare.P.VH, encShare.S.V) {
+		return errorDecVerification
+	}
 	if err := decShare.P.Verify(suite, G, decShare.S.V, X, encShare.S.V); err != nil {
 		return errorDecVerification
 	}
@@ -159,13 +267,30 @@ func VerifyDecShare(suite Suite, G kyber.Point, X kyber.Point, encShare *PubVerS
 
 // VerifyDecShareBatch provides the same functionality as VerifyDecShare but for
 // slices of decrypted shares. The function returns the the valid decrypted shares.
+// As in VerifyEncShareBatch, all proofs are checked at once using
+// dleq.VerifyBatch, after the same subgroup checks as in VerifyDecShare.
 func VerifyDecShareBatch(suite Suite, G kyber.Point, X []kyber.Point, encShares []*PubVerShare, decShares []*PubVerShare) ([]*PubVerShare, error) {
 	if len(X) != len(encShares) || len(encShares) != len(decShares) {
 		return nil, errorDifferentLengths
 	}
+	n := len(decShares)
+	GS := make([]kyber.Point, n)
+	sG := make([]kyber.Point, n)
+	sX := make([]kyber.Point, n)
+	proofs := make([]*dleq.Proof, n)
+	for i := 0; i < n; i++ {
+		GS[i] = G
+		sG[i] = decShares[i].S.V
+		sX[i] = encShares[i].S.V
+		proofs[i] = &decShares[i].P
+	}
+	errs := verifyBatch(suite, GS, sG, X, sX, proofs, func(i int) bool {
+		ds := decShares[i]
+		return inSubgroup(ds.S.V, ds.P.VG, ds.P.VH, encShares[i].S.V)
+	})
 	var D []*PubVerShare // good decrypted shares
-	for i := 0; i < len(X); i++ {
-		if err := VerifyDecShare(suite, G, X[i], encShares[i], decShares[i]); err == nil {
+	for i := 0; i < n; i++ {
+		if errs == nil || errs[i] == nil {
 			D = append(D, decShares[i])
 		}
 	}
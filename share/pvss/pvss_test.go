@@ -1,6 +1,7 @@
 package pvss
 
 import (
+	"bytes"
 	"testing"
 
 	"github.com/dedis/kyber"
@@ -256,3 +257,98 @@ func TestPVSSBatch(test *testing.T) {
 	require.True(test, suite.Point().Mul(s1, nil).Equal(S1))
 	require.True(test, suite.Point().Mul(s2, nil).Equal(S2))
 }
+
+func TestPVSSBatchInvalid(test *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	G := suite.Point().Base()
+	H := suite.Point().Pick(suite.XOF([]byte("H")))
+	n := 10
+	t := 2*n/3 + 1
+	x := make([]kyber.Scalar, n) // trustee private keys
+	X := make([]kyber.Point, n)  // trustee public keys
+	for i := 0; i < n; i++ {
+		x[i] = suite.Scalar().Pick(suite.RandomStream())
+		X[i] = suite.Point().Mul(x[i], nil)
+	}
+	secret := suite.Scalar().Pick(suite.RandomStream())
+	encShares, pubPoly, err := EncShares(suite, H, X, secret, t)
+	require.Equal(test, err, nil)
+	sH := make([]kyber.Point, n)
+	for i := 0; i < n; i++ {
+		sH[i] = pubPoly.Eval(encShares[i].S.I).V
+	}
+
+	// Corrupt some of the encrypted shares
+	encShares[2].S.V = suite.Point().Null()
+	encShares[7].P.R = suite.Scalar().Pick(suite.RandomStream())
+	K, E, err := VerifyEncShareBatch(suite, H, X, sH, encShares)
+	require.Equal(test, err, nil)
+	require.Equal(test, n-2, len(E))
+	for i, e := range E {
+		require.Nil(test, VerifyEncShare(suite, H, K[i], pubPoly.Eval(e.S.I).V, e))
+		require.NotEqual(test, 2, e.S.I)
+		require.NotEqual(test, 7, e.S.I)
+	}
+
+	K, E, D, err := DecShareBatch(suite, H, X, sH, x[0], encShares)
+	require.Equal(test, err, nil)
+	require.Equal(test, n-2, len(D))
+
+	// Decrypt with the right keys and corrupt some of the decrypted shares
+	for i := range E {
+		ds, err := DecShare(suite, H, K[i], pubPoly.Eval(E[i].S.I).V, x[E[i].S.I], E[i])
+		require.Equal(test, err, nil)
+		D[i] = ds
+	}
+	D[0].S.V = suite.Point().Null()
+	D[4].P.C = suite.Scalar().Pick(suite.RandomStream())
+	good, err := VerifyDecShareBatch(suite, G, K, E, D)
+	require.Equal(test, err, nil)
+	require.Equal(test, n-4, len(good))
+	for _, d := range good {
+		require.False(test, d == D[0] || d == D[4])
+	}
+}
+
+func TestPVSSSmallOrderShare(test *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	G := suite.Point().Base()
+	H := suite.Point().Pick(suite.XOF([]byte("H")))
+	n := 10
+	t := 2*n/3 + 1
+	x := make([]kyber.Scalar, n) // trustee private keys
+	X := make([]kyber.Point, n)  // trustee public keys
+	for i := 0; i < n; i++ {
+		x[i] = suite.Scalar().Pick(suite.RandomStream())
+		X[i] = suite.Point().Mul(x[i], nil)
+	}
+	secret := suite.Scalar().Pick(suite.RandomStream())
+	encShares, pubPoly, err := EncShares(suite, H, X, secret, t)
+	require.Equal(test, err, nil)
+	D := make([]*PubVerShare, n)
+	for i := 0; i < n; i++ {
+		D[i], err = DecShare(suite, H, X[i], pubPoly.Eval(encShares[i].S.I).V, x[i], encShares[i])
+		require.Equal(test, err, nil)
+	}
+
+	// Shift a decrypted share by the order-2 point (0,-1), keeping its proof.
+	T := suite.Point()
+	require.Nil(test, T.UnmarshalBinary(append([]byte{0xec}, append(bytes.Repeat([]byte{0xff}, 30), 0x7f)...)))
+	D[3].S.V = suite.Point().Add(D[3].S.V, T)
+	require.Equal(test, errorDecVerification, VerifyDecShare(suite, G, X[3], encShares[3], D[3]))
+	for i := 0; i < 10; i++ {
+		good, err := VerifyDecShareBatch(suite, G, X, encShares, D)
+		require.Equal(test, err, nil)
+		require.Equal(test, n-1, len(good))
+		for _, d := range good {
+			require.False(test, d == D[3])
+		}
+	}
+
+	// The shifted share never enters the recovered secret.
+	recovered, err := RecoverSecret(suite, G, X, encShares, D, t, n)
+	require.Equal(test, err, nil)
+	require.True(test, suite.Point().Mul(secret, nil).Equal(recovered))
+	_, err = RecoverSecret(suite, G, X[:t], encShares[:t], D[:t], t, n)
+	require.Equal(test, errorTooFewShares, err)
+}
@@ -43,10 +43,12 @@ func newAEAD(fn func() hash.Hash, preSharedKey kyber.Point, context []byte) (cip
 func context(suite Suite, dealer kyber.Point, verifiers []kyber.Point) []byte {
 	h := suite.Hash()
 	_, _ = h.Write([]byte("vss-dealer"))
-	_, _ = dealer.MarshalTo(h)
+	buf, _ := dealer.AppendBinary(nil)
+	_, _ = h.Write(buf)
 	_, _ = h.Write([]byte("vss-verifiers"))
 	for _, v := range verifiers {
-		_, _ = v.MarshalTo(h)
+		buf, _ = v.AppendBinary(buf[:0])
+		_, _ = h.Write(buf)
 	}
 	return h.Sum(nil)
 }
@@ -11,10 +11,13 @@ import (
 	"errors"
 	"fmt"
 	"reflect"
+	"runtime"
+	"sync"
 
 	"github.com/dedis/kyber"
 	"github.com/dedis/kyber/share"
 	"github.com/dedis/kyber/sign/schnorr"
+	"github.com/dedis/kyber/util/random"
 	"github.com/dedis/protobuf"
 )
 
@@ -174,28 +177,39 @@ func (d *Dealer) PlaintextDeal(i int) (*Deal, error) {
 // This shared key is then fed into a HKDF whose output is the key to a AEAD
 // (AES256-GCM) scheme to encrypt the deal.
 func (d *Dealer) EncryptedDeal(i int) (*EncryptedDeal, error) {
+	return d.encryptedDeal(d.suite, i, nil)
+}
+
+// encryptedDeal is EncryptedDeal drawing its randomness from suite. If
+// commits is not nil, it holds the dealer's commitments with their encoding
+// already computed, to be marshaled in place of deals sharing them.
+func (d *Dealer) encryptedDeal(suite Suite, i int, commits []kyber.Point) (*EncryptedDeal, error) {
 	vPub, ok := findPub(d.verifiers, uint32(i))
 	if !ok {
 		return nil, errors.New("dealer: wrong index to generate encrypted deal")
 	}
 	// gen ephemeral key
-	dhSecret := d.suite.Scalar().Pick(d.suite.RandomStream())
-	dhPublic := d.suite.Point().Mul(dhSecret, nil)
+	dhSecret := suite.Scalar().Pick(suite.RandomStream())
+	dhPublic := suite.Point().Mul(dhSecret, nil)
 	// signs the public key
 	dhPublicBuff, _ := dhPublic.MarshalBinary()
-	signature, err := schnorr.Sign(d.suite, d.long, dhPublicBuff)
+	signature, err := schnorr.Sign(suite, d.long, dhPublicBuff)
 	if err != nil {
 		return nil, err
 	}
 	// AES128-GCM
-	pre := dhExchange(d.suite, dhSecret, vPub)
-	gcm, err := newAEAD(d.suite.Hash, pre, d.hkdfContext)
+	pre := dhExchange(suite, dhSecret, vPub)
+	gcm, err := newAEAD(suite.Hash, pre, d.hkdfContext)
 	if err != nil {
 		return nil, err
 	}
 
 	nonce := make([]byte, gcm.NonceSize())
-	dealBuff, err := d.deals[i].MarshalBinary()
+	deal := *d.deals[i]
+	if commits != nil && sameCommits(deal.Commitments, d.secretCommits) {
+		deal.Commitments = commits
+	}
+	dealBuff, err := deal.MarshalBinary()
 	if err != nil {
 		return nil, err
 	}
@@ -208,14 +222,57 @@ func (d *Dealer) EncryptedDeal(i int) (*EncryptedDeal, error) {
 	}, nil
 }
 
+// marshaledPoint is a point whose encoding is computed only once,
+// as every deal marshals the same commitments.
+type marshaledPoint struct {
+	kyber.Point
+	buff []byte
+}
+
+func (p *marshaledPoint) MarshalBinary() ([]byte, error) {
+	return p.buff, nil
+}
+
+func sameCommits(a, b []kyber.Point) bool {
+	return len(a) == len(b) && (len(a) == 0 || &a[0] == &b[0])
+}
+
 // EncryptedDeals calls `EncryptedDeal` for each index of the verifier and
 // returns the list of encrypted deals. Each index in the returned slice
 // corresponds to the index in the list of verifiers.
+// The deals are encrypted in parallel, using all available CPUs. Every
+// worker draws its randomness from its own stream, seeded from the suite's
+// random stream, which thus need not be safe for concurrent use.
 func (d *Dealer) EncryptedDeals() ([]*EncryptedDeal, error) {
+	commits := make([]kyber.Point, len(d.secretCommits))
+	for i, c := range d.secretCommits {
+		buff, err := c.MarshalBinary()
+		if err != nil {
+			return nil, err
+		}
+		commits[i] = &marshaledPoint{c, buff}
+	}
+
 	deals := make([]*EncryptedDeal, len(d.verifiers))
-	var err error
-	for i := range d.verifiers {
-		deals[i], err = d.EncryptedDeal(i)
+	errs := make([]error, len(d.verifiers))
+	workers := runtime.GOMAXPROCS(0)
+	if workers > len(deals) {
+		workers = len(deals)
+	}
+	var wg sync.WaitGroup
+	for w := 0; w < workers; w++ {
+		seed := random.Bits(256, false, d.suite.RandomStream())
+		suite := &streamSuite{d.suite, d.suite.XOF(seed)}
+		wg.Add(1)
+		go func(w int) {
+			defer wg.Done()
+			for i := w; i < len(deals); i += workers {
+				deals[i], errs[i] = d.encryptedDeal(suite, i, commits)
+			}
+		}(w)
+	}
+	wg.Wait()
+	for _, err := range errs {
 		if err != nil {
 			return nil, err
 		}
@@ -223,6 +280,16 @@ func (d *Dealer) EncryptedDeals() ([]*EncryptedDeal, error) {
 	return deals, nil
 }
 
+// streamSuite is a Suite with a private random stream.
+type streamSuite struct {
+	Suite
+	stream cipher.Stream
+}
+
+func (s *streamSuite) RandomStream() cipher.Stream {
+	return s.stream
+}
+
 // ProcessResponse analyzes the given Response. If it's a valid complaint, then
 // it returns a Justification. This Justification must be broadcasted to every
 // participants. If it's an invalid complaint, it returns an error about the
@@ -677,11 +744,11 @@ func validT(t int, verifiers []kyber.Point) bool {
 }
 
 func deriveH(suite Suite, verifiers []kyber.Point) kyber.Point {
-	var b bytes.Buffer
+	var b []byte
 	for _, v := range verifiers {
-		_, _ = v.MarshalTo(&b)
+		b, _ = v.AppendBinary(b)
 	}
-	base := suite.Point().Pick(suite.XOF(b.Bytes()))
+	base := suite.Point().Pick(suite.XOF(b))
 	return base
 }
 
@@ -695,14 +762,17 @@ func findPub(verifiers []kyber.Point, idx uint32) (kyber.Point, bool) {
 
 func sessionID(suite Suite, dealer kyber.Point, verifiers, commitments []kyber.Point, t int) ([]byte, error) {
 	h := suite.Hash()
-	_, _ = dealer.MarshalTo(h)
+	buf, _ := dealer.AppendBinary(nil)
+	_, _ = h.Write(buf)
 
 	for _, v := range verifiers {
-		_, _ = v.MarshalTo(h)
+		buf, _ = v.AppendBinary(buf[:0])
+		_, _ = h.Write(buf)
 	}
 
 	for _, c := range commitments {
-		_, _ = c.MarshalTo(h)
+		buf, _ = c.AppendBinary(buf[:0])
+		_, _ = h.Write(buf)
 	}
 	_ = binary.Write(h, binary.LittleEndian, uint32(t))
 
@@ -570,6 +570,20 @@ func TestVSSSessionID(t *testing.T) {
 	assert.NotEqual(t, sid3, sid2)
 }
 
+func TestVSSSessionIDAllocs(t *testing.T) {
+	// The number of allocations must not depend on the number of points.
+	allocs := func(n int) float64 {
+		points := make([]kyber.Point, n)
+		for i := range points {
+			points[i] = dealerPub
+		}
+		return testing.AllocsPerRun(10, func() {
+			_, _ = sessionID(suite, dealerPub, points, points, vssThreshold)
+		})
+	}
+	assert.Equal(t, allocs(10), allocs(1000))
+}
+
 func TestVSSFindPub(t *testing.T) {
 	p, ok := findPub(verifiersPub, 0)
 	assert.True(t, ok)
@@ -630,3 +644,14 @@ func randomBytes(n int) []byte {
 	}
 	return buff
 }
+
+func BenchmarkVSSEncryptedDeals(b *testing.B) {
+	_, pubs := genCommits(100)
+	d, err := NewDealer(suite, dealerSec, secret, pubs, MinimumT(len(pubs)))
+	require.Nil(b, err)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_, err := d.EncryptedDeals()
+		require.Nil(b, err)
+	}
+}
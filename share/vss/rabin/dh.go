@@ -45,10 +45,12 @@ const keySize = 128
 // context returns the context slice to be used when encrypting a share
 func context(suite Suite, dealer kyber.Point, verifiers []kyber.Point) []byte {
 	h := suite.XOF([]byte("vss-dealer"))
-	_, _ = dealer.MarshalTo(h)
+	buf, _ := dealer.AppendBinary(nil)
+	_, _ = h.Write(buf)
 	_, _ = h.Write([]byte("vss-verifiers"))
 	for _, v := range verifiers {
-		_, _ = v.MarshalTo(h)
+		buf, _ = v.AppendBinary(buf[:0])
+		_, _ = h.Write(buf)
 	}
 	sum := make([]byte, keySize)
 	h.Read(sum)
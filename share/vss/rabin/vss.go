@@ -146,6 +146,11 @@ func NewDealer(suite Suite, longterm, secret kyber.Scalar, verifiers []kyber.Poi
 	d.t = t
 
 	H := deriveH(d.suite, d.verifiers)
+	// The dealer uses H for all its commitments and for every deal it
+	// justifies, and g.Commit reuses its table.
+	if p, ok := H.(kyber.Precomputable); ok {
+		p.Precompute()
+	}
 	f := share.NewPriPoly(d.suite, d.t, d.secret)
 	g := share.NewPriPoly(d.suite, d.t, nil)
 	d.pub = d.suite.Point().Mul(d.long, nil)
@@ -166,7 +171,7 @@ func NewDealer(suite Suite, longterm, secret kyber.Scalar, verifiers []kyber.Poi
 		return nil, err
 	}
 
-	d.aggregator = newAggregator(d.suite, d.pub, d.verifiers, commitments, d.t, d.sessionID)
+	d.aggregator = newAggregator(d.suite, d.pub, d.verifiers, commitments, H, d.t, d.sessionID)
 	// C = F + G
 	d.deals = make([]*Deal, len(d.verifiers))
 	for i := range d.verifiers {
@@ -388,7 +393,8 @@ func (v *Verifier) ProcessEncryptedDeal(e *EncryptedDeal) (*Response, error) {
 	}
 
 	if v.aggregator == nil {
-		v.aggregator = newAggregator(v.suite, v.dealer, v.verifiers, d.Commitments, t, d.SessionID)
+		H := deriveH(v.suite, v.verifiers)
+		v.aggregator = newAggregator(v.suite, v.dealer, v.verifiers, d.Commitments, H, t, d.SessionID)
 	}
 
 	r := &Response{
@@ -512,6 +518,7 @@ type aggregator struct {
 	dealer    kyber.Point
 	verifiers []kyber.Point
 	commits   []kyber.Point
+	h         kyber.Point // second base of the commitments
 
 	responses map[uint32]*Response
 	sid       []byte
@@ -520,12 +527,13 @@ type aggregator struct {
 	badDealer bool
 }
 
-func newAggregator(suite Suite, dealer kyber.Point, verifiers, commitments []kyber.Point, t int, sid []byte) *aggregator {
+func newAggregator(suite Suite, dealer kyber.Point, verifiers, commitments []kyber.Point, h kyber.Point, t int, sid []byte) *aggregator {
 	agg := &aggregator{
 		suite:     suite,
 		dealer:    dealer,
 		verifiers: verifiers,
 		commits:   commitments,
+		h:         h,
 		t:         t,
 		sid:       sid,
 		responses: make(map[uint32]*Response),
@@ -567,8 +575,7 @@ func (a *aggregator) VerifyDeal(d *Deal, inclusion bool) error {
 	}
 	// compute fi * G + gi * H
 	fig := a.suite.Point().Base().Mul(fi.V, nil)
-	H := deriveH(a.suite, a.verifiers)
-	gih := a.suite.Point().Mul(gi.V, H)
+	gih := a.suite.Point().Mul(gi.V, a.h)
 	ci := a.suite.Point().Add(fig, gih)
 
 	commitPoly := share.NewPubPoly(a.suite, nil, d.Commitments)
@@ -702,11 +709,11 @@ func validT(t int, verifiers []kyber.Point) bool {
 }
 
 func deriveH(suite Suite, verifiers []kyber.Point) kyber.Point {
-	var b bytes.Buffer
+	var b []byte
 	for _, v := range verifiers {
-		_, _ = v.MarshalTo(&b)
+		b, _ = v.AppendBinary(b)
 	}
-	base := suite.Point().Pick(suite.XOF(b.Bytes()))
+	base := suite.Point().Pick(suite.XOF(b))
 	return base
 }
 
@@ -720,14 +727,17 @@ func findPub(verifiers []kyber.Point, idx uint32) (kyber.Point, bool) {
 
 func sessionID(suite Suite, dealer kyber.Point, verifiers, commitments []kyber.Point, t int) ([]byte, error) {
 	h := suite.Hash()
-	_, _ = dealer.MarshalTo(h)
+	buf, _ := dealer.AppendBinary(nil)
+	_, _ = h.Write(buf)
 
 	for _, v := range verifiers {
-		_, _ = v.MarshalTo(h)
+		buf, _ = v.AppendBinary(buf[:0])
+		_, _ = h.Write(buf)
 	}
 
 	for _, c := range commitments {
-		_, _ = c.MarshalTo(h)
+		buf, _ = c.AppendBinary(buf[:0])
+		_, _ = h.Write(buf)
 	}
 	_ = binary.Write(h, binary.LittleEndian, uint32(t))
 
@@ -27,9 +27,12 @@ import (
 	"crypto/cipher"
 	"encoding/binary"
 	"errors"
+	"sync"
 
 	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/internal/parallel"
 	"github.com/dedis/kyber/proof"
+	"github.com/dedis/kyber/util/alloc"
 	"github.com/dedis/kyber/util/random"
 )
 
@@ -154,25 +157,42 @@ func (ps *PairShuffle) Prove(
 	var tau0, nu, gamma kyber.Scalar
 	ctx.PriRand(u, w, a, &tau0, &nu, &gamma)
 
-	// compute public commits
+	// compute public commits, in parallel chunks. The Lambda sums involve
+	// the secrets w and u, so they use constant time Mul rather than a
+	// multi-scalar multiplication.
 	p1.Gamma = grp.Point().Mul(gamma, g)
 	wbeta := grp.Scalar() // scratch
 	wbetasum := grp.Scalar().Set(tau0)
-	p1.Lambda1 = grp.Point().Null()
-	p1.Lambda2 = grp.Point().Null()
-	XY := grp.Point()  // scratch
-	wu := grp.Scalar() // scratch
 	for i := 0; i < k; i++ {
-		p1.A[i] = grp.Point().Mul(a[i], g)
-		p1.C[i] = grp.Point().Mul(z.Mul(gamma, a[pi[i]]), g)
-		p1.U[i] = grp.Point().Mul(u[i], g)
-		p1.W[i] = grp.Point().Mul(z.Mul(gamma, w[i]), g)
 		wbetasum.Add(wbetasum, wbeta.Mul(w[i], beta[pi[i]]))
-		p1.Lambda1.Add(p1.Lambda1, XY.Mul(wu.Sub(w[piinv[i]], u[i]), X[i]))
-		p1.Lambda2.Add(p1.Lambda2, XY.Mul(wu.Sub(w[piinv[i]], u[i]), Y[i]))
 	}
-	p1.Lambda1.Add(p1.Lambda1, XY.Mul(wbetasum, g))
-	p1.Lambda2.Add(p1.Lambda2, XY.Mul(wbetasum, h))
+	p1.Lambda1 = grp.Point().Mul(wbetasum, g)
+	p1.Lambda2 = grp.Point().Mul(wbetasum, h)
+	p1.A = alloc.Points(grp, k)
+	p1.C = alloc.Points(grp, k)
+	p1.U = alloc.Points(grp, k)
+	p1.W = alloc.Points(grp, k)
+	var mu sync.Mutex
+	parallel.Range(k, func(lo, hi int) {
+		z := grp.Scalar()  // scratch
+		XY := grp.Point()  // scratch
+		wu := grp.Scalar() // scratch
+		L1 := grp.Point().Null()
+		L2 := grp.Point().Null()
+		for i := lo; i < hi; i++ {
+			p1.A[i].Mul(a[i], g)
+			p1.C[i].Mul(z.Mul(gamma, a[pi[i]]), g)
+			p1.U[i].Mul(u[i], g)
+			p1.W[i].Mul(z.Mul(gamma, w[i]), g)
+			wu.Sub(w[piinv[i]], u[i])
+			L1.Add(L1, XY.Mul(wu, X[i]))
+			L2.Add(L2, XY.Mul(wu, Y[i]))
+		}
+		mu.Lock()
+		p1.Lambda1.Add(p1.Lambda1, L1)
+		p1.Lambda2.Add(p1.Lambda2, L2)
+		mu.Unlock()
+	})
 	if err := ctx.Put(p1); err != nil {
 		return err
 	}
@@ -182,23 +202,18 @@ func (ps *PairShuffle) Prove(
 	if err := ctx.PubRand(v2); err != nil {
 		return err
 	}
-	B := make([]kyber.Point, k)
-	for i := 0; i < k; i++ {
-		P := grp.Point().Mul(v2.Zrho[i], g)
-		B[i] = P.Sub(P, p1.U[i])
-	}
 
 	// P step 3
 	p3 := &ps.p3
-	b := make([]kyber.Scalar, k)
+	b := alloc.Scalars(grp, k)
 	for i := 0; i < k; i++ {
-		b[i] = grp.Scalar().Sub(v2.Zrho[i], u[i])
+		b[i].Sub(v2.Zrho[i], u[i])
 	}
-	d := make([]kyber.Scalar, k)
+	d := alloc.Scalars(grp, k)
 	for i := 0; i < k; i++ {
-		d[i] = grp.Scalar().Mul(gamma, b[pi[i]])
-		p3.D[i] = grp.Point().Mul(d[i], g)
+		d[i].Mul(gamma, b[pi[i]])
 	}
+	p3.D = mulAll(grp, d, g)
 	if err := ctx.Put(p3); err != nil {
 		return err
 	}
@@ -211,17 +226,18 @@ func (ps *PairShuffle) Prove(
 
 	// P step 5
 	p5 := &ps.p5
-	r := make([]kyber.Scalar, k)
+	r := alloc.Scalars(grp, k)
 	for i := 0; i < k; i++ {
-		r[i] = grp.Scalar().Add(a[i], z.Mul(v4.Zlambda, b[i]))
+		r[i].Add(a[i], z.Mul(v4.Zlambda, b[i]))
 	}
-	s := make([]kyber.Scalar, k)
+	s := alloc.Scalars(grp, k)
 	for i := 0; i < k; i++ {
-		s[i] = grp.Scalar().Mul(gamma, r[pi[i]])
+		s[i].Mul(gamma, r[pi[i]])
 	}
 	p5.Ztau = grp.Scalar().Neg(tau0)
+	p5.Zsigma = alloc.Scalars(grp, k)
 	for i := 0; i < k; i++ {
-		p5.Zsigma[i] = grp.Scalar().Add(w[i], b[pi[i]])
+		p5.Zsigma[i].Add(w[i], b[pi[i]])
 		p5.Ztau.Add(p5.Ztau, z.Mul(b[i], beta[i]))
 	}
 	if err := ctx.Put(p5); err != nil {
@@ -232,7 +248,9 @@ func (ps *PairShuffle) Prove(
 	return ps.pv6.Prove(g, gamma, r, s, rand, ctx)
 }
 
-// Verify ElGamal Pair Shuffle proofs.
+// Verify ElGamal Pair Shuffle proofs. In groups with a cofactor, the
+// equations which are combined with random weights, (33) and those of the
+// embedded simple k-shuffle, are checked up to small-order components.
 func (ps *PairShuffle) Verify(
 	g, h kyber.Point, X, Y, Xbar, Ybar []kyber.Point,
 	ctx proof.VerifierContext) error {
@@ -255,11 +273,6 @@ func (ps *PairShuffle) Verify(
 	if err := ctx.PubRand(v2); err != nil {
 		return err
 	}
-	B := make([]kyber.Point, k)
-	for i := 0; i < k; i++ {
-		P := grp.Point().Mul(v2.Zrho[i], g)
-		B[i] = P.Sub(P, p1.U[i])
-	}
 
 	// P step 3
 	p3 := &ps.p3
@@ -284,27 +297,36 @@ func (ps *PairShuffle) Verify(
 		return err
 	}
 
-	// V step 7
-	Phi1 := grp.Point().Null()
-	Phi2 := grp.Point().Null()
-	P := grp.Point() // scratch
-	Q := grp.Point() // scratch
+	// V step 7: (31)-(35), with each sum computed by multi-scalar
+	// multiplication. The k equations (33), sigma_i*Gamma == W_i + D_i,
+	// are combined with random weights e_i into one.
+	scalars := make([]kyber.Scalar, 2*k)
 	for i := 0; i < k; i++ {
-		Phi1 = Phi1.Add(Phi1, P.Mul(p5.Zsigma[i], Xbar[i])) // (31)
-		Phi1 = Phi1.Sub(Phi1, P.Mul(v2.Zrho[i], X[i]))
-		Phi2 = Phi2.Add(Phi2, P.Mul(p5.Zsigma[i], Ybar[i])) // (32)
-		Phi2 = Phi2.Sub(Phi2, P.Mul(v2.Zrho[i], Y[i]))
-		//		println("i",i)
-		if !P.Mul(p5.Zsigma[i], p1.Gamma).Equal( // (33)
-			Q.Add(p1.W[i], p3.D[i])) {
-			return errors.New("invalid PairShuffleProof")
-		}
+		scalars[i] = p5.Zsigma[i]
+		scalars[k+i] = grp.Scalar().Neg(v2.Zrho[i])
+	}
+	Phi1 := multiExp(grp, scalars, append(Xbar[:k:k], X...)) // (31)
+	Phi2 := multiExp(grp, scalars, append(Ybar[:k:k], Y...)) // (32)
+
+	e := batchWeights(grp, k)
+	esigma := grp.Scalar().Zero()
+	z := grp.Scalar() // scratch
+	scalars = make([]kyber.Scalar, 0, 2*k+1)
+	points := make([]kyber.Point, 0, 2*k+1)
+	for i := 0; i < k; i++ {
+		esigma.Add(esigma, z.Mul(e[i], p5.Zsigma[i]))
+		e[i].Neg(e[i])
+		scalars = append(scalars, e[i], e[i])
+		points = append(points, p1.W[i], p3.D[i])
+	}
+	scalars = append(scalars, esigma)
+	points = append(points, p1.Gamma)
+	if !batchHolds(grp, multiExp(grp, scalars, points)) { // (33)
+		return errors.New("invalid PairShuffleProof")
 	}
-	//	println("last")
-	//	println("Phi1",Phi1.String());
-	//	println("Phi2",Phi2.String());
-	//	println("1",P.Add(p1.Lambda1,Q.Mul(g,p5.Ztau)).String());
-	//	println("2",P.Add(p1.Lambda2,Q.Mul(h,p5.Ztau)).String());
+
+	P, Q := grp.Point(), grp.Point() // scratch
+
 	if !P.Add(p1.Lambda1, Q.Mul(p5.Ztau, g)).Equal(Phi1) || // (34)
 		!P.Add(p1.Lambda2, Q.Mul(p5.Ztau, h)).Equal(Phi2) { // (35)
 		return errors.New("invalid PairShuffleProof")
@@ -343,20 +365,22 @@ func Shuffle(group kyber.Group, g, h kyber.Point, X, Y []kyber.Point,
 	}
 
 	// Pick a fresh ElGamal blinding factor for each pair
-	beta := make([]kyber.Scalar, k)
+	beta := alloc.Scalars(ps.grp, k)
 	for i := 0; i < k; i++ {
-		beta[i] = ps.grp.Scalar().Pick(rand)
+		beta[i].Pick(rand)
 	}
 
 	// Create the output pair vectors
-	Xbar := make([]kyber.Point, k)
-	Ybar := make([]kyber.Point, k)
-	for i := 0; i < k; i++ {
-		Xbar[i] = ps.grp.Point().Mul(beta[pi[i]], g)
-		Xbar[i].Add(Xbar[i], X[pi[i]])
-		Ybar[i] = ps.grp.Point().Mul(beta[pi[i]], h)
-		Ybar[i].Add(Ybar[i], Y[pi[i]])
-	}
+	Xbar := alloc.Points(ps.grp, k)
+	Ybar := alloc.Points(ps.grp, k)
+	parallel.Range(k, func(lo, hi int) {
+		for i := lo; i < hi; i++ {
+			Xbar[i].Mul(beta[pi[i]], g)
+			Xbar[i].Add(Xbar[i], X[pi[i]])
+			Ybar[i].Mul(beta[pi[i]], h)
+			Ybar[i].Add(Ybar[i], Y[pi[i]])
+		}
+	})
 
 	prover := func(ctx proof.ProverContext) error {
 		return ps.Prove(pi, g, h, beta, X, Y, rand, ctx)
@@ -0,0 +1,63 @@
+// +build experimental
+
+package shuffle
+
+import (
+	"sync"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/internal/parallel"
+	"github.com/dedis/kyber/util/alloc"
+	"github.com/dedis/kyber/util/msm"
+	"github.com/dedis/kyber/util/random"
+)
+
+// mulAll returns the points s[i]*G, computed in parallel.
+func mulAll(grp kyber.Group, s []kyber.Scalar, G kyber.Point) []kyber.Point {
+	P := alloc.Points(grp, len(s))
+	parallel.Range(len(s), func(lo, hi int) {
+		for i := lo; i < hi; i++ {
+			P[i].Mul(s[i], G)
+		}
+	})
+	return P
+}
+
+// multiExp returns the sum of scalars[i]*points[i], with one multi-scalar
+// multiplication per CPU. Like msm.Sum, it may run in variable time, so it
+// must only be used on public values.
+func multiExp(grp kyber.Group, scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	sum := grp.Point().Null()
+	var mu sync.Mutex
+	parallel.Range(len(scalars), func(lo, hi int) {
+		P := msm.Sum(grp.Point(), scalars[lo:hi], points[lo:hi])
+		mu.Lock()
+		sum.Add(sum, P)
+		mu.Unlock()
+	})
+	return sum
+}
+
+// batchWeights returns n random scalars for combining n verification
+// equations into one.
+func batchWeights(grp kyber.Group, n int) []kyber.Scalar {
+	stream := random.New()
+	r := alloc.Scalars(grp, n)
+	for i := range r {
+		r[i].Pick(stream)
+	}
+	return r
+}
+
+// batchHolds reports whether a combination of verification equations with
+// random weights, whose value is P, holds. The weights cannot be relied upon
+// to cancel small-order components of the points, so in groups whose points
+// implement kyber.CofactorComparable, P is only compared with the identity
+// up to such components; otherwise the verdict on a proof with such
+// components would depend on the weights.
+func batchHolds(grp kyber.Group, P kyber.Point) bool {
+	if c, ok := P.(kyber.CofactorComparable); ok {
+		return c.EqualCofactor(grp.Point().Null())
+	}
+	return P.Equal(grp.Point().Null())
+}
@@ -19,6 +19,45 @@ func TestShuffle(t *testing.T) {
 	shuffleTest(s, k, N)
 }
 
+func TestShuffleInvalid(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519WithRand(blake.New(nil))
+	rand := suite.RandomStream()
+	H := suite.Point().Mul(suite.Scalar().Pick(rand), nil)
+	X := make([]kyber.Point, 20)
+	Y := make([]kyber.Point, 20)
+	for i := range X {
+		X[i] = suite.Point().Pick(rand)
+		Y[i] = suite.Point().Pick(rand)
+	}
+	Xbar, Ybar, prover := Shuffle(suite, nil, H, X, Y, rand)
+	prf, err := proof.HashProve(suite, "PairShuffle", prover)
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	// a re-randomized pair that was not part of the shuffle
+	Xbar[3] = suite.Point().Add(Xbar[3], suite.Point().Base())
+	verifier := Verifier(suite, nil, H, X, Y, Xbar, Ybar)
+	if proof.HashVerify(suite, "PairShuffle", verifier, prf) == nil {
+		t.Fatal("shuffle with a modified pair accepted")
+	}
+	Xbar[3].Sub(Xbar[3], suite.Point().Base())
+
+	// a modified proof
+	for _, i := range []int{0, len(prf) / 3, len(prf) / 2, len(prf) - 40} {
+		prf[i] ^= 1
+		verifier = Verifier(suite, nil, H, X, Y, Xbar, Ybar)
+		if proof.HashVerify(suite, "PairShuffle", verifier, prf) == nil {
+			t.Fatalf("proof modified at byte %d accepted", i)
+		}
+		prf[i] ^= 1
+	}
+	verifier = Verifier(suite, nil, H, X, Y, Xbar, Ybar)
+	if err := proof.HashVerify(suite, "PairShuffle", verifier, prf); err != nil {
+		t.Fatal(err)
+	}
+}
+
 func shuffleTest(suite Suite, k, N int) {
 	rand := suite.RandomStream()
 
@@ -66,3 +105,11 @@ func shuffleTest(suite Suite, k, N int) {
 		}
 	}
 }
+
+func benchmarkShuffleEd25519(b *testing.B, k int) {
+	shuffleTest(edwards25519.NewBlakeSHA256Ed25519WithRand(blake.New(nil)), k, b.N)
+}
+
+func Benchmark1kPairShuffleEd25519(b *testing.B)   { benchmarkShuffleEd25519(b, 1000) }
+func Benchmark10kPairShuffleEd25519(b *testing.B)  { benchmarkShuffleEd25519(b, 10000) }
+func Benchmark100kPairShuffleEd25519(b *testing.B) { benchmarkShuffleEd25519(b, 100000) }
@@ -7,7 +7,9 @@ import (
 	"errors"
 
 	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/internal/parallel"
 	"github.com/dedis/kyber/proof"
+	"github.com/dedis/kyber/util/alloc"
 )
 
 // XX the Zs in front of some field names are a kludge to make them
@@ -51,26 +53,24 @@ type SimpleShuffle struct {
 	p4  ssa4
 }
 
-// Simple helper to compute G^{ab-cd} for Theta vector computation.
-func thenc(grp kyber.Group, G kyber.Point,
-	a, b, c, d kyber.Scalar) kyber.Point {
-
-	var ab, cd kyber.Scalar
+// Simple helper to set P = G^{ab-cd} for Theta vector computation,
+// using ab and cd as scratch space.
+func thenc(P, G kyber.Point, a, b, c, d, ab, cd kyber.Scalar) kyber.Point {
 	if a != nil {
-		ab = grp.Scalar().Mul(a, b)
+		ab.Mul(a, b)
 	} else {
-		ab = grp.Scalar().Zero()
+		ab.Zero()
 	}
 	if c != nil {
 		if d != nil {
-			cd = grp.Scalar().Mul(c, d)
+			cd.Mul(c, d)
 		} else {
-			cd = c
+			cd.Set(c)
 		}
 	} else {
-		cd = grp.Scalar().Zero()
+		cd.Zero()
 	}
-	return grp.Point().Mul(ab.Sub(ab, cd), G)
+	return P.Mul(ab.Sub(ab, cd), G)
 }
 
 // Init initializes the simple shuffle with the given group and the k parameter
@@ -111,10 +111,8 @@ func (ss *SimpleShuffle) Prove(G kyber.Point, gamma kyber.Scalar,
 	//	}
 
 	// Step 0: inputs
-	for i := 0; i < k; i++ { // (4)
-		ss.p0.X[i] = grp.Point().Mul(x[i], G)
-		ss.p0.Y[i] = grp.Point().Mul(y[i], G)
-	}
+	ss.p0.X = mulAll(grp, x, G) // (4)
+	ss.p0.Y = mulAll(grp, y, G)
 	if err := ctx.Put(ss.p0); err != nil {
 		return err
 	}
@@ -127,26 +125,33 @@ func (ss *SimpleShuffle) Prove(G kyber.Point, gamma kyber.Scalar,
 
 	// P step 2
 	gammaT := grp.Scalar().Mul(gamma, t)
-	xhat := make([]kyber.Scalar, k)
-	yhat := make([]kyber.Scalar, k)
+	xhat := alloc.Scalars(grp, k)
+	yhat := alloc.Scalars(grp, k)
 	for i := 0; i < k; i++ { // (5) and (6) xhat,yhat vectors
-		xhat[i] = grp.Scalar().Sub(x[i], t)
-		yhat[i] = grp.Scalar().Sub(y[i], gammaT)
+		xhat[i].Sub(x[i], t)
+		yhat[i].Sub(y[i], gammaT)
 	}
 	thlen := 2*k - 1 // (7) theta and Theta vectors
 	theta := make([]kyber.Scalar, thlen)
 	ctx.PriRand(theta)
-	Theta := make([]kyber.Point, thlen+1)
-	Theta[0] = thenc(grp, G, nil, nil, theta[0], yhat[0])
-	for i := 1; i < k; i++ {
-		Theta[i] = thenc(grp, G, theta[i-1], xhat[i],
-			theta[i], yhat[i])
-	}
-	for i := k; i < thlen; i++ {
-		Theta[i] = thenc(grp, G, theta[i-1], gamma,
-			theta[i], nil)
-	}
-	Theta[thlen] = thenc(grp, G, theta[thlen-1], gamma, nil, nil)
+	Theta := alloc.Points(grp, thlen+1)
+	parallel.Range(thlen+1, func(lo, hi int) {
+		ab, cd := grp.Scalar(), grp.Scalar() // scratch
+		for i := lo; i < hi; i++ {
+			switch {
+			case i == 0:
+				thenc(Theta[0], G, nil, nil, theta[0], yhat[0], ab, cd)
+			case i < k:
+				thenc(Theta[i], G, theta[i-1], xhat[i],
+					theta[i], yhat[i], ab, cd)
+			case i < thlen:
+				thenc(Theta[i], G, theta[i-1], gamma,
+					theta[i], nil, ab, cd)
+			default:
+				thenc(Theta[thlen], G, theta[thlen-1], gamma, nil, nil, ab, cd)
+			}
+		}
+	})
 	ss.p2.Theta = Theta
 	if err := ctx.Put(ss.p2); err != nil {
 		return err
@@ -159,34 +164,26 @@ func (ss *SimpleShuffle) Prove(G kyber.Point, gamma kyber.Scalar,
 	c := ss.v3.Zc
 
 	// P step 4
-	alpha := make([]kyber.Scalar, thlen)
+	alpha := alloc.Scalars(grp, thlen)
 	runprod := grp.Scalar().Set(c)
 	for i := 0; i < k; i++ { // (8)
 		runprod.Mul(runprod, xhat[i])
 		runprod.Div(runprod, yhat[i])
-		alpha[i] = grp.Scalar().Add(theta[i], runprod)
+		alpha[i].Add(theta[i], runprod)
 	}
 	gammainv := grp.Scalar().Inv(gamma)
 	rungamma := grp.Scalar().Set(c)
 	for i := 1; i < k; i++ {
 		rungamma.Mul(rungamma, gammainv)
-		alpha[thlen-i] = grp.Scalar().Add(theta[thlen-i], rungamma)
+		alpha[thlen-i].Add(theta[thlen-i], rungamma)
 	}
 	ss.p4.Zalpha = alpha
 	return ctx.Put(ss.p4)
 }
 
-// Simple helper to verify Theta elements,
-// by checking whether A^a*B^-b = T.
-// P,Q,s are simply "scratch" kyber.Point/Scalars reused for efficiency.
-func thver(A, B, T, P, Q kyber.Point, a, b, s kyber.Scalar) bool {
-	P.Mul(a, A)
-	Q.Mul(s.Neg(b), B)
-	P.Add(P, Q)
-	return P.Equal(T)
-}
-
-// Verify for Neff simple k-shuffle proofs.
+// Verify for Neff simple k-shuffle proofs. In groups with a cofactor, the
+// equations of step 5 are checked up to small-order components, as they
+// are combined with random weights.
 func (ss *SimpleShuffle) Verify(G, Gamma kyber.Point,
 	ctx proof.VerifierContext) error {
 
@@ -225,32 +222,43 @@ func (ss *SimpleShuffle) Verify(G, Gamma kyber.Point,
 		return err
 	}
 
-	// Verifier step 5
-	negt := grp.Scalar().Neg(t)
-	U := grp.Point().Mul(negt, G)
-	W := grp.Point().Mul(negt, Gamma)
-	Xhat := make([]kyber.Point, k)
-	Yhat := make([]kyber.Point, k)
-	for i := 0; i < k; i++ {
-		Xhat[i] = grp.Point().Add(X[i], U)
-		Yhat[i] = grp.Point().Add(Y[i], W)
-	}
-	P := grp.Point() // scratch variables
-	Q := grp.Point()
-	s := grp.Scalar()
-	good := true
-	good = good && thver(Xhat[0], Yhat[0], Theta[0], P, Q, c, alpha[0], s)
-	for i := 1; i < k; i++ {
-		good = good && thver(Xhat[i], Yhat[i], Theta[i], P, Q,
-			alpha[i-1], alpha[i], s)
-	}
-	for i := k; i < thlen; i++ {
-		good = good && thver(Gamma, G, Theta[i], P, Q,
-			alpha[i-1], alpha[i], s)
+	// Verifier step 5: check Theta[i] == a_i*A_i - b_i*B_i for all i at
+	// once, combining the equations with random weights e_i. For i < k,
+	// A_i = X_i - t*G and B_i = Y_i - t*Gamma, and otherwise A_i = Gamma and
+	// B_i = G, so all the terms in G and in Gamma are gathered into one.
+	e := batchWeights(grp, thlen+1)
+	scalars := make([]kyber.Scalar, 0, 2*k+thlen+3)
+	points := make([]kyber.Point, 0, 2*k+thlen+3)
+	sG := grp.Scalar().Zero()
+	sGamma := grp.Scalar().Zero()
+	z := grp.Scalar() // scratch
+	for i := 0; i <= thlen; i++ {
+		a, b := c, alpha[0]
+		if i > 0 {
+			a = alpha[i-1]
+			if i < thlen {
+				b = alpha[i]
+			} else {
+				b = c
+			}
+		}
+		ea := grp.Scalar().Mul(e[i], a)
+		eb := grp.Scalar().Mul(e[i], b)
+		if i < k {
+			sG.Sub(sG, z.Mul(t, ea))
+			sGamma.Add(sGamma, z.Mul(t, eb))
+			scalars = append(scalars, ea, eb.Neg(eb))
+			points = append(points, X[i], Y[i])
+		} else {
+			sGamma.Add(sGamma, ea)
+			sG.Sub(sG, eb)
+		}
+		scalars = append(scalars, e[i].Neg(e[i]))
+		points = append(points, Theta[i])
 	}
-	good = good && thver(Gamma, G, Theta[thlen], P, Q,
-		alpha[thlen-1], c, s)
-	if !good {
+	scalars = append(scalars, sG, sGamma)
+	points = append(points, G, Gamma)
+	if !batchHolds(grp, multiExp(grp, scalars, points)) {
 		return errors.New("incorrect SimpleShuffleProof")
 	}
 
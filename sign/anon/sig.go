@@ -5,6 +5,7 @@ import (
 	"errors"
 
 	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/internal/parallel"
 )
 
 // unlinkable ring signature
@@ -131,7 +132,9 @@ func Sign(suite Suite, message []byte,
 	if linkScope != nil {
 		linkStream := suite.XOF(linkScope)
 		linkBase = suite.Point().Pick(linkStream)
+		precompute(linkBase, n)
 		linkTag = suite.Point().Mul(privateKey, linkBase)
+		precompute(linkTag, n)
 	}
 
 	// First pre-hash the parameters to H1
@@ -147,9 +150,18 @@ func Sign(suite Suite, message []byte,
 		UL = suite.Point().Mul(u, linkBase)
 	}
 
-	// Build the challenge ring
+	// Build the challenge ring. The s[i] parts of each step do not
+	// depend on the challenges, so they are computed up front.
 	s := make([]kyber.Scalar, n)
 	c := make([]kyber.Scalar, n)
+	for i := (pi + 1) % n; i != pi; i = (i + 1) % n {
+		s[i] = suite.Scalar().Pick(suite.RandomStream())
+	}
+	SG := ringMul(suite, s, nil)
+	var SH []kyber.Point
+	if linkScope != nil {
+		SH = ringMul(suite, s, linkBase)
+	}
 	c[(pi+1)%n] = signH1(suite, H1pre, UB, UL)
 	var P, PG, PH kyber.Point
 	P = suite.Point()
@@ -158,10 +170,9 @@ func Sign(suite Suite, message []byte,
 		PH = suite.Point()
 	}
 	for i := (pi + 1) % n; i != pi; i = (i + 1) % n {
-		s[i] = suite.Scalar().Pick(suite.RandomStream())
-		PG.Add(PG.Mul(s[i], nil), P.Mul(c[i], L[i]))
+		PG.Add(SG[i], P.Mul(c[i], L[i]))
 		if linkScope != nil {
-			PH.Add(PH.Mul(s[i], linkBase), P.Mul(c[i], linkTag))
+			PH.Add(SH[i], P.Mul(c[i], linkTag))
 		}
 		c[(i+1)%n] = signH1(suite, H1pre, PG, PH)
 		//fmt.Printf("s%d %s\n",i,s[i].String())
@@ -209,7 +220,9 @@ func Verify(suite Suite, message []byte, anonymitySet Set,
 		}
 		linkStream := suite.XOF(linkScope)
 		linkBase = suite.Point().Pick(linkStream)
+		precompute(linkBase, n)
 		linkTag = sig.Tag
+		precompute(linkTag, n)
 	} else { // unlinkable ring signature
 		if err := suite.Read(buf, &sig.C0); err != nil {
 			return nil, err
@@ -230,11 +243,16 @@ func Verify(suite Suite, message []byte, anonymitySet Set,
 		PH = suite.Point()
 	}
 	s := sig.S
+	SG := ringMul(suite, s, nil)
+	var SH []kyber.Point
+	if linkScope != nil {
+		SH = ringMul(suite, s, linkBase)
+	}
 	ci := sig.C0
 	for i := 0; i < n; i++ {
-		PG.Add(PG.Mul(s[i], nil), P.Mul(ci, L[i]))
+		PG.Add(SG[i], P.Mul(ci, L[i]))
 		if linkScope != nil {
-			PH.Add(PH.Mul(s[i], linkBase), P.Mul(ci, linkTag))
+			PH.Add(SH[i], P.Mul(ci, linkTag))
 		}
 		ci = signH1(suite, H1pre, PG, PH)
 	}
@@ -249,3 +267,30 @@ func Verify(suite Suite, message []byte, anonymitySet Set,
 	}
 	return []byte{}, nil
 }
+
+// minPrecompute is the ring size from which Sign and Verify precompute the
+// tables of the linkage base and tag, used once per ring member.
+const minPrecompute = 8
+
+// precompute precomputes the table of multiples of p if its group
+// implements kyber.Precomputable and the ring of size n is large enough
+// to pay for it.
+func precompute(p kyber.Point, n int) {
+	if pc, ok := p.(kyber.Precomputable); ok && n >= minPrecompute {
+		pc.Precompute()
+	}
+}
+
+// ringMul returns the products s[i]*base, or nil for a nil s[i]. The
+// products are independent of each other and computed in parallel.
+func ringMul(suite Suite, s []kyber.Scalar, base kyber.Point) []kyber.Point {
+	prods := make([]kyber.Point, len(s))
+	parallel.Range(len(s), func(lo, hi int) {
+		for i := lo; i < hi; i++ {
+			if s[i] != nil {
+				prods[i] = suite.Point().Mul(s[i], base)
+			}
+		}
+	})
+	return prods
+}
@@ -311,3 +311,59 @@ func BenchmarkVerify100Ed25519(b *testing.B) {
 	benchVerify(edwards25519.NewBlakeSHA256Ed25519(),
 		benchPubEd25519[:100], benchSig100Ed25519, b.N)
 }
+
+func TestSignPrecomputed(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	X, x := benchGenKeys(suite, 20)
+	raw := make(Set, len(X))
+	for i := range X {
+		raw[i] = X[i].Clone()
+	}
+	set := Set(X)
+	set.Precompute()
+
+	for _, scope := range [][]byte{nil, []byte("scope")} {
+		sig := Sign(suite, benchMessage, set, scope, 0, x)
+		tag, err := Verify(suite, benchMessage, raw, scope, sig)
+		if err != nil {
+			t.Fatal(err)
+		}
+		tag2, err := Verify(suite, benchMessage, set, scope, Sign(suite, benchMessage, raw, scope, 0, x))
+		if err != nil {
+			t.Fatal(err)
+		}
+		if !bytes.Equal(tag, tag2) {
+			t.Fatal("linkage tags differ")
+		}
+		if _, err := Verify(suite, []byte("other"), set, scope, sig); err == nil {
+			t.Fatal("signature verified for another message")
+		}
+	}
+}
+
+func benchmarkVerifyLarge(b *testing.B, precompute bool, linkScope []byte) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	X, x := benchGenKeys(suite, 1000)
+	set := Set(X)
+	if precompute {
+		set.Precompute()
+	}
+	sig := Sign(suite, benchMessage, set, linkScope, 0, x)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if _, err := Verify(suite, benchMessage, set, linkScope, sig); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkVerify1kEd25519(b *testing.B) { benchmarkVerifyLarge(b, false, nil) }
+func BenchmarkVerify1kPrecomputedEd25519(b *testing.B) {
+	benchmarkVerifyLarge(b, true, nil)
+}
+func BenchmarkVerify1kLinkableEd25519(b *testing.B) {
+	benchmarkVerifyLarge(b, false, []byte("scope"))
+}
+func BenchmarkVerify1kLinkablePrecomputedEd25519(b *testing.B) {
+	benchmarkVerifyLarge(b, true, []byte("scope"))
+}
@@ -0,0 +1,100 @@
+package cosi
+
+import (
+	"encoding/binary"
+	"errors"
+	"sync"
+
+	"github.com/dedis/kyber"
+)
+
+// Aggregator incrementally accumulates the commitments, participation masks
+// and responses of a subtree of cosigners, such as an interior node of a
+// tree-structured CoSi overlay collecting the contributions of its children.
+// Contributions are added in place as they arrive, without allocating, and
+// the partial aggregates can be retrieved at any time, so the cost of each
+// contribution does not depend on how many have been received before.
+// An Aggregator is safe for concurrent use.
+type Aggregator struct {
+	mu       sync.Mutex
+	suite    Suite
+	commit   kyber.Point
+	mask     []byte
+	response kyber.Scalar
+}
+
+// NewAggregator returns a new Aggregator for participation masks of maskLen
+// bytes, i.e., Mask.Len() of the cosigners' masks.
+func NewAggregator(suite Suite, maskLen int) *Aggregator {
+	return &Aggregator{
+		suite:    suite,
+		commit:   suite.Point().Null(),
+		mask:     make([]byte, maskLen),
+		response: suite.Scalar().Zero(),
+	}
+}
+
+// AddCommitment adds the (aggregate) commitment of a cosigner or subtree to
+// the aggregate commitment, together with its participation mask. It returns
+// an error if the mask has the wrong length or overlaps with the mask of a
+// previous contribution, since the commitments of the cosigners in common
+// would then be counted twice.
+func (a *Aggregator) AddCommitment(commitment kyber.Point, mask []byte) error {
+	if commitment == nil {
+		return errors.New("no commitment provided")
+	}
+	if len(mask) != len(a.mask) {
+		return errors.New("mismatching mask lengths")
+	}
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	if overlap(a.mask, mask) {
+		return errors.New("overlapping masks")
+	}
+	a.commit.Add(a.commit, commitment)
+	orMasks(a.mask, a.mask, mask)
+	return nil
+}
+
+// AddResponse adds the (aggregate) response of a cosigner or subtree to the
+// aggregate response.
+func (a *Aggregator) AddResponse(response kyber.Scalar) error {
+	if response == nil {
+		return errors.New("no response provided")
+	}
+	a.mu.Lock()
+	a.response.Add(a.response, response)
+	a.mu.Unlock()
+	return nil
+}
+
+// Commitment returns a copy of the current aggregate commitment and of the
+// participation mask of the cosigners it includes.
+func (a *Aggregator) Commitment() (kyber.Point, []byte) {
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	mask := make([]byte, len(a.mask))
+	copy(mask, a.mask)
+	return a.commit.Clone(), mask
+}
+
+// Response returns a copy of the current aggregate response.
+func (a *Aggregator) Response() kyber.Scalar {
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	return a.response.Clone()
+}
+
+// overlap returns whether the masks a and b of the same length have a common
+// enabled bit.
+func overlap(a, b []byte) bool {
+	var w uint64
+	i := 0
+	for ; i+8 <= len(a); i += 8 {
+		w |= binary.LittleEndian.Uint64(a[i:]) & binary.LittleEndian.Uint64(b[i:])
+	}
+	for ; i < len(a); i++ {
+		w |= uint64(a[i] & b[i])
+	}
+	return w != 0
+}
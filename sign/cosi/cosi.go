@@ -40,8 +40,10 @@ the leader computes the aggregate response r = \sum{j ∈ P'}(r_j) and publishes
 package cosi
 
 import (
+	"encoding/binary"
 	"errors"
 	"fmt"
+	"math/bits"
 
 	"github.com/dedis/kyber"
 )
@@ -65,11 +67,11 @@ func AggregateCommitments(suite Suite, commitments []kyber.Point, masks [][]byte
 	aggMask := make([]byte, len(masks[0]))
 
 	for i := range commitments {
-		aggCom = suite.Point().Add(aggCom, commitments[i])
-		aggMask, err = AggregateMasks(aggMask, masks[i])
-		if err != nil {
-			return nil, nil, err
+		if len(masks[i]) != len(aggMask) {
+			return nil, nil, errors.New("mismatching mask lengths")
 		}
+		aggCom.Add(aggCom, commitments[i])
+		orMasks(aggMask, aggMask, masks[i])
 	}
 	return aggCom, aggMask, nil
 }
@@ -84,13 +86,15 @@ func Challenge(suite Suite, commitment, public kyber.Point, message []byte) (kyb
 	if message == nil {
 		return nil, errors.New("no message provided")
 	}
-	hash := suite.Hash()
-	if _, err := commitment.MarshalTo(hash); err != nil {
+	buf, err := commitment.AppendBinary(nil)
+	if err != nil {
 		return nil, err
 	}
-	if _, err := public.MarshalTo(hash); err != nil {
+	if buf, err = public.AppendBinary(buf); err != nil {
 		return nil, err
 	}
+	hash := suite.Hash()
+	hash.Write(buf)
 	hash.Write(message)
 	return suite.Scalar().SetBytes(hash.Sum(nil)), nil
 }
@@ -154,11 +158,25 @@ func Sign(suite Suite, commitment kyber.Point, response kyber.Scalar, mask *Mask
 }
 
 // Verify checks the given cosignature on the provided message using the list
-// of public keys and cosigning policy.
+// of public keys and cosigning policy. Verifiers checking many signatures by
+// the same list of cosigners should use a Roster instead.
 func Verify(suite Suite, publics []kyber.Point, message, sig []byte, policy Policy) error {
 	if publics == nil {
 		return errors.New("no public keys provided")
 	}
+	mask, err := NewMask(suite, publics, nil)
+	if err != nil {
+		return err
+	}
+	return verify(suite, message, sig, policy, func(bitmask []byte) (*Mask, error) {
+		return mask, mask.SetMask(bitmask)
+	})
+}
+
+// verify checks the given cosignature on the provided message, using the
+// participation mask, and thus the aggregate public key, returned by
+// setMask for the bitmask of the signature.
+func verify(suite Suite, message, sig []byte, policy Policy, setMask func([]byte) (*Mask, error)) error {
 	if message == nil {
 		return errors.New("no message provided")
 	}
@@ -170,6 +188,10 @@ func Verify(suite Suite, publics []kyber.Point, message, sig []byte, policy Poli
 	}
 
 	lenCom := suite.PointLen()
+	lenRes := lenCom + suite.ScalarLen()
+	if len(sig) < lenRes {
+		return errors.New("signature too short")
+	}
 	VBuff := sig[:lenCom]
 	V := suite.Point()
 	if err := V.UnmarshalBinary(VBuff); err != nil {
@@ -177,16 +199,14 @@ func Verify(suite Suite, publics []kyber.Point, message, sig []byte, policy Poli
 	}
 
 	// Unpack the aggregate response
-	lenRes := lenCom + suite.ScalarLen()
 	rBuff := sig[lenCom:lenRes]
 	r := suite.Scalar().SetBytes(rBuff)
 
 	// Unpack the participation mask and get the aggregate public key
-	mask, err := NewMask(suite, publics, nil)
+	mask, err := setMask(sig[lenRes:])
 	if err != nil {
 		return err
 	}
-	mask.SetMask(sig[lenRes:])
 	A := mask.AggregatePublic
 	ABuff, err := A.MarshalBinary()
 	if err != nil {
@@ -268,16 +288,21 @@ func (m *Mask) SetMask(mask []byte) error {
 	if m.Len() != len(mask) {
 		return fmt.Errorf("mismatching mask lengths")
 	}
-	for i := range m.publics {
-		byt := i >> 3
-		msk := byte(1) << uint(i&7)
-		if ((m.mask[byt] & msk) == 0) && ((mask[byt] & msk) != 0) {
-			m.mask[byt] ^= msk // flip bit in mask from 0 to 1
-			m.AggregatePublic.Add(m.AggregatePublic, m.publics[i])
-		}
-		if ((m.mask[byt] & msk) != 0) && ((mask[byt] & msk) == 0) {
-			m.mask[byt] ^= msk // flip bit in mask from 1 to 0
-			m.AggregatePublic.Sub(m.AggregatePublic, m.publics[i])
+	// Only visit the cosigners whose bit changes, a 64-bit word at a time.
+	n := len(m.publics)
+	for k := 0; 64*k < n; k++ {
+		w := maskWord(mask, k)
+		diff := (maskWord(m.mask, k) ^ w) & validBits(n, k)
+		for diff != 0 {
+			j := uint(bits.TrailingZeros64(diff))
+			diff &= diff - 1
+			i := 64*k + int(j)
+			m.mask[i>>3] ^= byte(1) << uint(i&7) // flip bit in mask
+			if w&(1<<j) != 0 {
+				m.AggregatePublic.Add(m.AggregatePublic, m.publics[i])
+			} else {
+				m.AggregatePublic.Sub(m.AggregatePublic, m.publics[i])
+			}
 		}
 	}
 	return nil
@@ -326,16 +351,7 @@ func (m *Mask) KeyEnabled(public kyber.Point) (bool, error) {
 // CountEnabled returns the number of enabled nodes in the CoSi participation
 // mask.
 func (m *Mask) CountEnabled() int {
-	// hw is hamming weight
-	hw := 0
-	for i := range m.publics {
-		byt := i >> 3
-		msk := byte(1) << uint(i&7)
-		if (m.mask[byt] & msk) != 0 {
-			hw++
-		}
-	}
-	return hw
+	return countBits(len(m.publics), m.mask, nil)
 }
 
 // CountTotal returns the total number of nodes this CoSi instance knows.
@@ -349,12 +365,66 @@ func AggregateMasks(a, b []byte) ([]byte, error) {
 		return nil, errors.New("mismatching mask lengths")
 	}
 	m := make([]byte, len(a))
-	for i := range m {
-		m[i] = a[i] | b[i]
-	}
+	orMasks(m, a, b)
 	return m, nil
 }
 
+// orMasks sets dst to the bitwise OR of the masks a and b of the same length,
+// a 64-bit word at a time. dst may alias a or b.
+func orMasks(dst, a, b []byte) {
+	i := 0
+	for ; i+8 <= len(dst); i += 8 {
+		w := binary.LittleEndian.Uint64(a[i:]) | binary.LittleEndian.Uint64(b[i:])
+		binary.LittleEndian.PutUint64(dst[i:], w)
+	}
+	for ; i < len(dst); i++ {
+		dst[i] = a[i] | b[i]
+	}
+}
+
+// clone returns a deep copy of the mask.
+func (m *Mask) clone() *Mask {
+	return &Mask{
+		mask:            m.Mask(),
+		publics:         m.publics,
+		AggregatePublic: m.AggregatePublic.Clone(),
+	}
+}
+
+// maskWord returns the k-th 64-bit word of the bitmask b in little-endian
+// order, i.e., the bits of cosigners 64k to 64k+63, padded with zeros past
+// the end of b.
+func maskWord(b []byte, k int) uint64 {
+	i := 8 * k
+	if i+8 <= len(b) {
+		return binary.LittleEndian.Uint64(b[i:])
+	}
+	var w uint64
+	for j := len(b) - 1; j >= i; j-- {
+		w = w<<8 | uint64(b[j])
+	}
+	return w
+}
+
+// validBits returns the bits of the k-th mask word which correspond to one
+// of n cosigners.
+func validBits(n, k int) uint64 {
+	if rest := n - 64*k; rest < 64 {
+		return 1<<uint(rest) - 1
+	}
+	return ^uint64(0)
+}
+
+// countBits returns the number of the n cosigners whose bits differ between
+// the bitmasks a and b, where a nil bitmask has all bits disabled.
+func countBits(n int, a, b []byte) int {
+	c := 0
+	for k := 0; 64*k < n; k++ {
+		c += bits.OnesCount64((maskWord(a, k) ^ maskWord(b, k)) & validBits(n, k))
+	}
+	return c
+}
+
 // Policy represents a fully customizable cosigning policy deciding what
 // cosigner sets are and aren't sufficient for a collective signature to be
 // considered acceptable to a verifier. The Check method may inspect the set of
@@ -250,3 +250,196 @@ func TestMask(t *testing.T) {
 		}
 	}
 }
+
+// genPublics generates n key pairs.
+func genPublics(n int) ([]kyber.Scalar, []kyber.Point) {
+	privates := make([]kyber.Scalar, n)
+	publics := make([]kyber.Point, n)
+	for i := range publics {
+		kp := key.NewKeyPair(testSuite)
+		privates[i], publics[i] = kp.Private, kp.Public
+	}
+	return privates, publics
+}
+
+// signMask returns the collective signature on the message by the
+// cosigners enabled in the bitmask.
+func signMask(t testing.TB, privates []kyber.Scalar, publics []kyber.Point, bitmask, message []byte) []byte {
+	mask, _ := NewMask(testSuite, publics, nil)
+	if err := mask.SetMask(bitmask); err != nil {
+		t.Fatal(err)
+	}
+	a := testSuite.Scalar().Zero()
+	for i := range privates {
+		if b, _ := mask.IndexEnabled(i); b {
+			a.Add(a, privates[i])
+		}
+	}
+	v, V := Commit(testSuite)
+	c, err := Challenge(testSuite, V, mask.AggregatePublic, message)
+	if err != nil {
+		t.Fatal(err)
+	}
+	r, _ := Response(testSuite, a, v, c)
+	sig, err := Sign(testSuite, V, r, mask)
+	if err != nil {
+		t.Fatal(err)
+	}
+	return sig
+}
+
+func TestRoster(t *testing.T) {
+	n := 150
+	message := []byte("Hello World Cosi")
+	privates, publics := genPublics(n)
+	roster, err := NewRoster(testSuite, publics)
+	if err != nil {
+		t.Fatal(err)
+	}
+	policy := NewThresholdPolicy(1)
+
+	// Go through masks close to full, empty and to the previous mask, with
+	// stray bits past the last cosigner which must be ignored.
+	bitmask := make([]byte, (n+7)/8)
+	for _, flips := range [][]int{{}, {3, 64, 149}, {3}, {0, 1, 2, 5, 77}, {}} {
+		for _, i := range flips {
+			bitmask[i>>3] ^= 1 << uint(i&7)
+		}
+		bitmask[len(bitmask)-1] ^= 0x80
+		for _, b := range [][]byte{bitmask, make([]byte, len(bitmask))} {
+			b[0] |= 0x10
+			sig := signMask(t, privates, publics, b, message)
+			if err := Verify(testSuite, publics, message, sig, policy); err != nil {
+				t.Fatal(err)
+			}
+			if err := roster.Verify(message, sig, policy); err != nil {
+				t.Fatal(err)
+			}
+			m, err := roster.Mask(b)
+			if err != nil {
+				t.Fatal(err)
+			}
+			ref, _ := NewMask(testSuite, publics, nil)
+			ref.SetMask(b)
+			if !m.AggregatePublic.Equal(ref.AggregatePublic) ||
+				m.CountEnabled() != ref.CountEnabled() {
+				t.Fatal("wrong aggregate public key")
+			}
+		}
+		for i := range bitmask {
+			bitmask[i] = ^bitmask[i]
+		}
+	}
+
+	sig := signMask(t, privates, publics, bitmask, message)
+	if err := roster.Verify([]byte("Hello World"), sig, policy); err == nil {
+		t.Fatal("invalid signature accepted")
+	}
+	if err := roster.Verify(message, sig[:len(sig)-1], policy); err == nil {
+		t.Fatal("signature with truncated mask accepted")
+	}
+	if err := roster.Verify(message, sig[:10], policy); err == nil {
+		t.Fatal("truncated signature accepted")
+	}
+}
+
+func benchmarkVerify(b *testing.B, roster bool) {
+	n := 1000
+	message := []byte("Hello World Cosi")
+	privates, publics := genPublics(n)
+	r, _ := NewRoster(testSuite, publics)
+
+	// Signatures by all but a handful of changing cosigners
+	sigs := make([][]byte, 16)
+	for i := range sigs {
+		bitmask := make([]byte, (n+7)/8)
+		for j := range bitmask {
+			bitmask[j] = 0xff
+		}
+		for j := 0; j < 5; j++ {
+			k := (i*37 + j*101) % n
+			bitmask[k>>3] &^= 1 << uint(k&7)
+		}
+		sigs[i] = signMask(b, privates, publics, bitmask, message)
+	}
+	policy := NewThresholdPolicy(n / 2)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		sig := sigs[i%len(sigs)]
+		if roster {
+			r.Verify(message, sig, policy)
+		} else {
+			Verify(testSuite, publics, message, sig, policy)
+		}
+	}
+}
+
+func BenchmarkVerify1000(b *testing.B)       { benchmarkVerify(b, false) }
+func BenchmarkRosterVerify1000(b *testing.B) { benchmarkVerify(b, true) }
+
+func TestAggregator(t *testing.T) {
+	n := 9
+	message := []byte("Hello World Cosi")
+	privates, publics := genPublics(n)
+
+	// A tree of depth 2: node i > 0 has parent (i-1)/2.
+	parent := func(i int) int { return (i - 1) / 2 }
+	masks := make([]*Mask, n)
+	v := make([]kyber.Scalar, n)
+	aggs := make([]*Aggregator, n)
+	for i := range masks {
+		masks[i], _ = NewMask(testSuite, publics, publics[i])
+		aggs[i] = NewAggregator(testSuite, masks[i].Len())
+	}
+
+	// Commitments travel up the tree, from the leaves.
+	var V kyber.Point
+	for i := n - 1; i >= 0; i-- {
+		var Vi kyber.Point
+		v[i], Vi = Commit(testSuite)
+		if err := aggs[i].AddCommitment(Vi, masks[i].Mask()); err != nil {
+			t.Fatal(err)
+		}
+		subV, subMask := aggs[i].Commitment()
+		if i == 0 {
+			V = subV
+			for j := range masks {
+				masks[j].SetMask(subMask)
+			}
+			break
+		}
+		if err := aggs[parent(i)].AddCommitment(subV, subMask); err != nil {
+			t.Fatal(err)
+		}
+	}
+	if masks[0].CountEnabled() != n {
+		t.Fatal("unexpected number of active indices")
+	}
+	if err := aggs[0].AddCommitment(V, masks[1].Mask()); err == nil {
+		t.Fatal("overlapping mask accepted")
+	}
+	if err := aggs[0].AddCommitment(V, nil); err == nil {
+		t.Fatal("short mask accepted")
+	}
+
+	// and so do responses.
+	c, err := Challenge(testSuite, V, masks[0].AggregatePublic, message)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for i := n - 1; i > 0; i-- {
+		ri, _ := Response(testSuite, privates[i], v[i], c)
+		aggs[i].AddResponse(ri)
+		aggs[parent(i)].AddResponse(aggs[i].Response())
+	}
+	r0, _ := Response(testSuite, privates[0], v[0], c)
+	aggs[0].AddResponse(r0)
+
+	sig, err := Sign(testSuite, V, aggs[0].Response(), masks[0])
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err := Verify(testSuite, publics, message, sig, nil); err != nil {
+		t.Fatal(err)
+	}
+}
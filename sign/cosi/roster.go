@@ -0,0 +1,80 @@
+package cosi
+
+import (
+	"errors"
+	"sync"
+
+	"github.com/dedis/kyber"
+)
+
+// Roster speeds up the verification of many collective signatures produced
+// by the same list of cosigners. Verify sums the public keys of all
+// participants of every signature. A Roster instead caches the aggregate of
+// all public keys and derives the aggregate public key of a signature from
+// whichever is closest to its participation mask: the aggregate of all keys,
+// minus the absent cosigners; the empty aggregate, plus the participants; or
+// the aggregate of the previous signature, updated with the cosigners whose
+// participation changed. Consecutive signatures are typically produced by
+// almost the same participants, so this costs only a few point additions.
+// A Roster is safe for concurrent use.
+type Roster struct {
+	suite Suite
+	all   *Mask // all cosigners enabled
+
+	mu   sync.Mutex
+	last *Mask // mask of the previous signature, never modified
+}
+
+// NewRoster returns a new Roster for the given list of public keys.
+func NewRoster(suite Suite, publics []kyber.Point) (*Roster, error) {
+	if publics == nil {
+		return nil, errors.New("no public keys provided")
+	}
+	all, err := NewMask(suite, publics, nil)
+	if err != nil {
+		return nil, err
+	}
+	full := make([]byte, all.Len())
+	for i := range full {
+		full[i] = 0xff
+	}
+	all.SetMask(full)
+	return &Roster{suite: suite, all: all, last: all}, nil
+}
+
+// Mask returns a new participation mask for the given bitmask, interpreted as
+// in Mask.SetMask, with its aggregate public key.
+func (r *Roster) Mask(bitmask []byte) (*Mask, error) {
+	if len(bitmask) != r.all.Len() {
+		return nil, errors.New("mismatching mask lengths")
+	}
+	r.mu.Lock()
+	last := r.last
+	r.mu.Unlock()
+
+	// Start from the closest known aggregate.
+	n := r.all.CountTotal()
+	enabled := countBits(n, bitmask, nil)
+	var m *Mask
+	switch changed := countBits(n, bitmask, last.mask); {
+	case changed <= enabled && changed <= n-enabled:
+		m = last.clone()
+	case enabled <= n-enabled:
+		m, _ = NewMask(r.suite, r.all.publics, nil)
+	default:
+		m = r.all.clone()
+	}
+	m.SetMask(bitmask)
+
+	r.mu.Lock()
+	r.last = m.clone()
+	r.mu.Unlock()
+	return m, nil
+}
+
+// Verify checks the given cosignature on the provided message using the
+// public keys of the roster and cosigning policy, just like the Verify
+// function.
+func (r *Roster) Verify(message, sig []byte, policy Policy) error {
+	return verify(r.suite, message, sig, policy, r.Mask)
+}
@@ -3,13 +3,18 @@
 package eddsa
 
 import (
+	"bytes"
 	"crypto/cipher"
 	"crypto/sha512"
 	"errors"
 	"fmt"
+	"hash"
+	"sync"
 
 	"github.com/dedis/kyber"
 	"github.com/dedis/kyber/group/edwards25519"
+	"github.com/dedis/kyber/internal/parallel"
+	"github.com/dedis/kyber/util/msm"
 	"github.com/dedis/kyber/util/random"
 )
 
@@ -78,72 +83,258 @@ func (e *EdDSA) UnmarshalBinary(buff []byte) error {
 }
 
 // Sign will return a EdDSA signature of the message msg using Ed25519.
+// To sign many messages with the same key, use a Signer.
 func (e *EdDSA) Sign(msg []byte) ([]byte, error) {
-	hash := sha512.New()
-	_, _ = hash.Write(e.prefix)
-	_, _ = hash.Write(msg)
+	sig := make([]byte, 64)
+	if err := e.NewSigner().SignInto(sig, msg); err != nil {
+		return nil, err
+	}
+	return sig, nil
+}
 
-	// deterministic random secret and its commit
-	r := group.Scalar().SetBytes(hash.Sum(nil))
-	R := group.Point().Mul(r, nil)
+// Signer is an EdDSA key prepared for signing many messages. It caches the
+// encoding of the public key and reuses its hash state and scalars from one
+// signature to the next, so that SignInto does not allocate. It keeps its
+// own copy of the key, so later changes to the EdDSA, e.g. by
+// UnmarshalBinary, do not affect it. A Signer is not safe for concurrent
+// use, but SignBatch signs on several goroutines at once.
+type Signer struct {
+	secret kyber.Scalar
+	prefix [32]byte
+	public [32]byte
+	hash   hash.Hash
+	digest [64]byte
+	r, h   kyber.Scalar
+	rPoint kyber.Point
+}
 
-	// challenge
-	// H( R || Public || Msg)
-	hash.Reset()
-	Rbuff, err := R.MarshalBinary()
-	if err != nil {
-		return nil, err
+// NewSigner returns a Signer for the key e.
+func (e *EdDSA) NewSigner() *Signer {
+	s := &Signer{
+		secret: e.Secret.Clone(),
+		hash:   sha512.New(),
+		r:      group.Scalar(),
+		h:      group.Scalar(),
+		rPoint: group.Point(),
 	}
-	Abuff, err := e.Public.MarshalBinary()
-	if err != nil {
+	copy(s.prefix[:], e.prefix)
+	b, _ := e.Public.AppendBinary(s.public[:0])
+	copy(s.public[:], b)
+	return s
+}
+
+// clone returns a Signer for the same key as s, with its own hash state and
+// scratch values. The secret is never modified, so the two share it.
+func (s *Signer) clone() *Signer {
+	c := *s
+	c.hash = sha512.New()
+	c.r = group.Scalar()
+	c.h = group.Scalar()
+	c.rPoint = group.Point()
+	return &c
+}
+
+// Sign returns the signature of msg.
+func (s *Signer) Sign(msg []byte) ([]byte, error) {
+	sig := make([]byte, 64)
+	if err := s.SignInto(sig, msg); err != nil {
 		return nil, err
 	}
+	return sig, nil
+}
 
-	_, _ = hash.Write(Rbuff)
-	_, _ = hash.Write(Abuff)
-	_, _ = hash.Write(msg)
+// SignInto writes the 64-byte signature R || s of msg to dst, which
+// must be at least 64 bytes long.
+func (s *Signer) SignInto(dst, msg []byte) error {
+	if len(dst) < 64 {
+		return errors.New("eddsa: signature buffer too short")
+	}
 
-	h := group.Scalar().SetBytes(hash.Sum(nil))
+	// deterministic random secret and its commit
+	s.hash.Reset()
+	_, _ = s.hash.Write(s.prefix[:])
+	_, _ = s.hash.Write(msg)
+	s.r.SetBytes(s.hash.Sum(s.digest[:0]))
+	s.rPoint.Mul(s.r, nil)
+	if _, err := s.rPoint.AppendBinary(dst[:0]); err != nil {
+		return err
+	}
+
+	// challenge
+	// H( R || Public || Msg)
+	s.hash.Reset()
+	_, _ = s.hash.Write(dst[:32])
+	_, _ = s.hash.Write(s.public[:])
+	_, _ = s.hash.Write(msg)
+	s.h.SetBytes(s.hash.Sum(s.digest[:0]))
 
 	// response
 	// s = r + h * s
-	s := group.Scalar().Mul(e.Secret, h)
-	s.Add(r, s)
+	s.h.Mul(s.secret, s.h)
+	s.h.Add(s.r, s.h)
+	_, err := s.h.AppendBinary(dst[32:32])
+	return err
+}
 
-	sBuff, err := s.MarshalBinary()
+// SignBatch returns the signatures of msgs, computed in parallel with one
+// Signer per available CPU.
+func (s *Signer) SignBatch(msgs [][]byte) ([][]byte, error) {
+	sigs := make([][]byte, len(msgs))
+	buf := make([]byte, 64*len(msgs))
+	for i := range sigs {
+		sigs[i] = buf[64*i : 64*(i+1) : 64*(i+1)]
+	}
+	var mu sync.Mutex
+	var err error
+	parallel.Range(len(msgs), func(lo, hi int) {
+		signer := s.clone()
+		for i := lo; i < hi; i++ {
+			if e := signer.SignInto(sigs[i], msgs[i]); e != nil {
+				mu.Lock()
+				err = e
+				mu.Unlock()
+				return
+			}
+		}
+	})
 	if err != nil {
 		return nil, err
 	}
-
-	// return R || s
-	var sig [64]byte
-	copy(sig[:], Rbuff)
-	copy(sig[32:], sBuff)
-
-	return sig[:], nil
+	return sigs, nil
 }
 
 // Verify uses a public key, a message and a signature. It will return nil if
 // sig is a valid signature for msg created by key public, or an error otherwise.
 func Verify(public kyber.Point, msg, sig []byte) error {
+	return verify(public, msg, sig, false)
+}
+
+// VerifyCofactored is like Verify but checks the cofactored equation
+// [8]s*B == [8]R + [8]h*A, as allowed by RFC8032. It accepts every signature
+// Verify accepts, and also signatures whose R or public key carry a
+// small-order component, which Verify rejects. It is the single-signature
+// counterpart of VerifyBatch.
+func VerifyCofactored(public kyber.Point, msg, sig []byte) error {
+	return verify(public, msg, sig, true)
+}
+
+func verify(public kyber.Point, msg, sig []byte, cofactored bool) error {
+	R, s, h, err := parse(public, msg, sig)
+	if err != nil {
+		return err
+	}
+
+	// reconstruct S == k*A + R
+	S := group.Point().Mul(s, nil)
+	hA := group.Point().Mul(h, public)
+	RhA := group.Point().Add(R, hA)
+
+	var equal bool
+	if cofactored {
+		equal = RhA.(kyber.CofactorComparable).EqualCofactor(S)
+	} else {
+		equal = RhA.Equal(S)
+	}
+	if !equal {
+		return errors.New("reconstructed S is not equal to signature")
+	}
+	return nil
+}
+
+// VerifyBatch verifies the signatures sigs[i] on msgs[i] by publics[i] all
+// at once. Instead of checking s*B == R + h*A for every signature, it checks
+// a random linear combination of these equations with a single multi-scalar
+// multiplication, which is several times faster than calling Verify on each
+// signature. If all signatures are valid, VerifyBatch returns nil. Otherwise,
+// it falls back to VerifyCofactored on the individual signatures and returns
+// a slice with one entry per signature, which is nil for valid signatures and
+// the error returned by VerifyCofactored for invalid ones.
+//
+// The combined equation is multiplied by the cofactor 8, since random
+// weights cannot reliably cancel small-order components: VerifyBatch thus
+// agrees with VerifyCofactored, not with Verify, and accepts signatures with
+// small-order components that Verify rejects. Callers who must reach the
+// same verdict as other verifiers, e.g. for consensus, should use either
+// VerifyBatch and VerifyCofactored or Verify alone. VerifyBatch panics if
+// the three slices differ in length.
+func VerifyBatch(publics []kyber.Point, msgs, sigs [][]byte) []error {
+	if len(publics) != len(msgs) || len(msgs) != len(sigs) {
+		panic("eddsa: mismatched batch lengths")
+	}
+	errs := make([]error, len(sigs))
+	failed := false
+
+	// The batch equation is
+	//   [8]((sum z_i*s_i)*B - sum z_i*R_i - sum (z_i*h_i)*A_i) == 0
+	// with random 128-bit z_i.
+	scalars := make([]kyber.Scalar, 1, 1+2*len(sigs))
+	points := make([]kyber.Point, 1, 1+2*len(sigs))
+	scalars[0] = group.Scalar().Zero()
+	batch := make([]int, 0, len(sigs))
+	rnd := make([]byte, 16)
+	stream := random.New()
+	for i := range sigs {
+		R, s, h, err := parse(publics[i], msgs[i], sigs[i])
+		if err != nil {
+			errs[i] = err
+			failed = true
+			continue
+		}
+		if !canonical(s, sigs[i][32:]) {
+			// Verify interprets unreduced responses on its own terms,
+			// leave them to it rather than to the batch equation.
+			if errs[i] = VerifyCofactored(publics[i], msgs[i], sigs[i]); errs[i] != nil {
+				failed = true
+			}
+			continue
+		}
+
+		random.Bytes(rnd, stream)
+		z := group.Scalar().SetBytes(rnd)
+		scalars[0].Add(scalars[0], s.Mul(s, z))
+		scalars = append(scalars, group.Scalar().Neg(z), h.Mul(h, z).Neg(h))
+		points = append(points, R, publics[i])
+		batch = append(batch, i)
+	}
+
+	if len(batch) > 0 {
+		sum := msm.Sum(group.Point(), scalars, points)
+		if !sum.(kyber.CofactorComparable).EqualCofactor(group.Point().Null()) {
+			for _, i := range batch {
+				if errs[i] = VerifyCofactored(publics[i], msgs[i], sigs[i]); errs[i] != nil {
+					failed = true
+				}
+			}
+		}
+	}
+
+	if !failed {
+		return nil
+	}
+	return errs
+}
+
+// parse decodes sig into its commitment R and response s, and reconstructs
+// the challenge h = H(R || Public || Msg).
+func parse(public kyber.Point, msg, sig []byte) (kyber.Point, kyber.Scalar, kyber.Scalar, error) {
 	if len(sig) != 64 {
-		return errors.New("signature length invalid")
+		return nil, nil, nil, errors.New("signature length invalid")
 	}
 
 	R := group.Point()
 	if err := R.UnmarshalBinary(sig[:32]); err != nil {
-		return fmt.Errorf("got R invalid point: %s", err)
+		return nil, nil, nil, fmt.Errorf("got R invalid point: %s", err)
 	}
 
 	s := group.Scalar()
 	if err := s.UnmarshalBinary(sig[32:]); err != nil {
-		return fmt.Errorf("schnorr: s invalid scalar %s", err)
+		return nil, nil, nil, fmt.Errorf("schnorr: s invalid scalar %s", err)
 	}
 
 	// reconstruct h = H(R || Public || Msg)
 	Pbuff, err := public.MarshalBinary()
 	if err != nil {
-		return err
+		return nil, nil, nil, err
 	}
 	hash := sha512.New()
 	_, _ = hash.Write(sig[:32])
@@ -151,15 +342,13 @@ func Verify(public kyber.Point, msg, sig []byte) error {
 	_, _ = hash.Write(msg)
 
 	h := group.Scalar().SetBytes(hash.Sum(nil))
-	// reconstruct S == k*A + R
-	S := group.Point().Mul(s, nil)
-	hA := group.Point().Mul(h, public)
-	RhA := group.Point().Add(R, hA)
+	return R, s, h, nil
+}
 
-	if !RhA.Equal(S) {
-		return errors.New("reconstructed S is not equal to signature")
-	}
-	return nil
+// canonical returns whether buff is the canonical, reduced encoding of s.
+func canonical(s kyber.Scalar, buff []byte) bool {
+	sBuff, err := s.MarshalBinary()
+	return err == nil && bytes.Equal(sBuff, buff)
 }
 
 func hashSeed(seed []byte) (hash [64]byte) {
@@ -5,11 +5,14 @@ import (
 	"bytes"
 	"compress/gzip"
 	"crypto/cipher"
+	"crypto/sha512"
 	"encoding/hex"
 	"os"
 	"strings"
 	"testing"
 
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/util/random"
 	"github.com/stretchr/testify/assert"
 )
 
@@ -95,6 +98,194 @@ func TestEdDSASigning(t *testing.T) {
 	}
 }
 
+func TestEdDSAVerifyBatch(t *testing.T) {
+	var publics []kyber.Point
+	var msgs, sigs [][]byte
+	for _, vec := range EdDSATestVectors {
+		seed, _ := hex.DecodeString(vec.private)
+		ed := NewEdDSA(ConstantStream(seed))
+		msg, _ := hex.DecodeString(vec.message)
+		sig, _ := hex.DecodeString(vec.signature)
+		publics = append(publics, ed.Public)
+		msgs = append(msgs, msg)
+		sigs = append(sigs, sig)
+	}
+	for i := 0; i < 200; i++ {
+		ed := NewEdDSA(random.New())
+		msg := []byte{byte(i), byte(i >> 8)}
+		sig, err := ed.Sign(msg)
+		assert.Nil(t, err)
+		publics = append(publics, ed.Public)
+		msgs = append(msgs, msg)
+		sigs = append(sigs, sig)
+	}
+	assert.Nil(t, VerifyBatch(publics[:3], msgs[:3], sigs[:3]))
+	assert.Nil(t, VerifyBatch(publics, msgs, sigs))
+	assert.Nil(t, VerifyBatch(nil, nil, nil))
+
+	// Corrupt a few entries.
+	msgs[1] = []byte("wrong message")
+	sigs[3] = sigs[3][:63]
+	sigs[100] = append([]byte{}, sigs[100]...)
+	sigs[100][40] ^= 1
+	publics[150] = publics[151]
+	errs := VerifyBatch(publics, msgs, sigs)
+	assert.Len(t, errs, len(sigs))
+	for i, err := range errs {
+		if i == 1 || i == 3 || i == 100 || i == 150 {
+			assert.Error(t, err)
+		} else {
+			assert.Nil(t, err)
+		}
+	}
+
+	assert.Panics(t, func() { VerifyBatch(publics, msgs[1:], sigs) })
+}
+
+func TestEdDSAVerifyCofactored(t *testing.T) {
+	// The order-2 point (0,-1).
+	T := group.Point()
+	assert.Nil(t, T.UnmarshalBinary(append([]byte{0xec}, append(bytes.Repeat([]byte{0xff}, 30), 0x7f)...)))
+
+	// Sign with a commitment R = r*B + T.
+	ed := NewEdDSA(random.New())
+	msg := []byte("small-order commitment")
+	r := group.Scalar().Pick(random.New())
+	R := group.Point().Mul(r, nil)
+	R.Add(R, T)
+	sig, err := R.MarshalBinary()
+	assert.Nil(t, err)
+	pub, err := ed.Public.MarshalBinary()
+	assert.Nil(t, err)
+	hash := sha512.New()
+	_, _ = hash.Write(sig)
+	_, _ = hash.Write(pub)
+	_, _ = hash.Write(msg)
+	h := group.Scalar().SetBytes(hash.Sum(nil))
+	s := group.Scalar().Mul(ed.Secret, h)
+	s.Add(s, r)
+	sig, err = s.AppendBinary(sig)
+	assert.Nil(t, err)
+
+	assert.Error(t, Verify(ed.Public, msg, sig))
+	assert.Nil(t, VerifyCofactored(ed.Public, msg, sig))
+	publics := []kyber.Point{ed.Public, ed.Public}
+	msgs := [][]byte{msg, []byte("other")}
+	sig2, err := ed.Sign(msgs[1])
+	assert.Nil(t, err)
+	for i := 0; i < 20; i++ {
+		// The batch must agree with VerifyCofactored whatever the weights.
+		assert.Nil(t, VerifyBatch(publics, msgs, [][]byte{sig, sig2}))
+	}
+	errs := VerifyBatch(publics, msgs, [][]byte{sig, sig})
+	assert.Len(t, errs, 2)
+	assert.Nil(t, errs[0])
+	assert.Error(t, errs[1])
+}
+
+func TestSigner(t *testing.T) {
+	for _, vec := range EdDSATestVectors {
+		seed, _ := hex.DecodeString(vec.private)
+		signer := NewEdDSA(ConstantStream(seed)).NewSigner()
+		msg, _ := hex.DecodeString(vec.message)
+		sig := make([]byte, 64)
+		assert.Nil(t, signer.SignInto(sig, msg))
+		assert.Equal(t, vec.signature, hex.EncodeToString(sig))
+	}
+
+	ed := NewEdDSA(random.New())
+	signer := ed.NewSigner()
+	msgs := make([][]byte, 100)
+	for i := range msgs {
+		msgs[i] = []byte{byte(i)}
+	}
+	sigs, err := signer.SignBatch(msgs)
+	assert.Nil(t, err)
+	for i, sig := range sigs {
+		want, _ := ed.Sign(msgs[i])
+		assert.Equal(t, want, sig)
+	}
+	sigs, err = signer.SignBatch(nil)
+	assert.Nil(t, err)
+	assert.Len(t, sigs, 0)
+
+	// Changing the key afterwards does not affect the signer.
+	public := ed.Public
+	other, _ := NewEdDSA(random.New()).MarshalBinary()
+	assert.Nil(t, ed.UnmarshalBinary(other))
+	sigs, err = signer.SignBatch(msgs)
+	assert.Nil(t, err)
+	for i, sig := range sigs {
+		assert.Nil(t, Verify(public, msgs[i], sig))
+	}
+
+	assert.Error(t, signer.SignInto(make([]byte, 63), msgs[0]))
+	sig := make([]byte, 64)
+	allocs := testing.AllocsPerRun(10, func() {
+		_ = signer.SignInto(sig, msgs[0])
+	})
+	assert.Equal(t, 0.0, allocs)
+}
+
+func BenchmarkSign(b *testing.B) {
+	ed := NewEdDSA(random.New())
+	msg := []byte("Hello World")
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_, _ = ed.Sign(msg)
+	}
+}
+
+func BenchmarkSignerSignInto(b *testing.B) {
+	signer := NewEdDSA(random.New()).NewSigner()
+	msg := []byte("Hello World")
+	sig := make([]byte, 64)
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_ = signer.SignInto(sig, msg)
+	}
+}
+
+func BenchmarkSignBatch64(b *testing.B) {
+	signer := NewEdDSA(random.New()).NewSigner()
+	msgs := make([][]byte, 64)
+	for i := range msgs {
+		msgs[i] = []byte{byte(i)}
+	}
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_, _ = signer.SignBatch(msgs)
+	}
+}
+
+func BenchmarkVerify(b *testing.B) {
+	ed := NewEdDSA(random.New())
+	msg := []byte("Hello World")
+	sig, _ := ed.Sign(msg)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_ = Verify(ed.Public, msg, sig)
+	}
+}
+
+func BenchmarkVerifyBatch64(b *testing.B) {
+	n := 64
+	publics := make([]kyber.Point, n)
+	msgs := make([][]byte, n)
+	sigs := make([][]byte, n)
+	for i := range sigs {
+		ed := NewEdDSA(random.New())
+		publics[i] = ed.Public
+		msgs[i] = []byte{byte(i)}
+		sigs[i], _ = ed.Sign(msgs[i])
+	}
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_ = VerifyBatch(publics, msgs, sigs)
+	}
+}
+
 type constantStream struct {
 	seed []byte
 }
@@ -18,6 +18,8 @@ import (
 	"fmt"
 
 	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/util/msm"
+	"github.com/dedis/kyber/util/random"
 )
 
 // Suite represents the set of functionalities needed by the package schnorr.
@@ -60,37 +62,139 @@ func Sign(s Suite, private kyber.Scalar, msg []byte) ([]byte, error) {
 // Verify verifies a given Schnorr signature. It returns nil iff the
 // given signature is valid.
 func Verify(g kyber.Group, public kyber.Point, msg, sig []byte) error {
+	return verify(g, public, msg, sig, kyber.Point.Equal)
+}
+
+// VerifyCofactored is like Verify but, in groups whose points implement
+// kyber.CofactorComparable, only checks the verification equation up to
+// small-order components. It then also accepts signatures whose R or public
+// key carry such components, which Verify rejects. In other groups it is
+// the same as Verify. It is the single-signature counterpart of VerifyBatch.
+func VerifyCofactored(g kyber.Group, public kyber.Point, msg, sig []byte) error {
+	return verify(g, public, msg, sig, equalCofactor)
+}
+
+func verify(g kyber.Group, public kyber.Point, msg, sig []byte, equal func(P, Q kyber.Point) bool) error {
+	R, s, h, err := parse(g, public, msg, sig)
+	if err != nil {
+		return err
+	}
+
+	// compute S = g^s
+	S := g.Point().Mul(s, nil)
+	// compute RAh = R + A^h
+	Ah := g.Point().Mul(h, public)
+	RAs := g.Point().Add(R, Ah)
+
+	if !equal(S, RAs) {
+		return errors.New("schnorr: invalid signature")
+	}
+
+	return nil
+}
+
+// equalCofactor compares P and Q up to small-order components if their
+// group supports it, and exactly otherwise.
+func equalCofactor(P, Q kyber.Point) bool {
+	if c, ok := P.(kyber.CofactorComparable); ok {
+		return c.EqualCofactor(Q)
+	}
+	return P.Equal(Q)
+}
+
+// VerifyBatch verifies the signatures sigs[i] on msgs[i] by publics[i] all
+// at once, by checking a random linear combination of the individual
+// verification equations with a single multi-scalar multiplication.
+// If all signatures are valid, VerifyBatch returns nil. Otherwise, it falls
+// back to VerifyCofactored on the individual signatures and returns a slice
+// with one entry per signature, which is nil for valid signatures and the
+// error returned by VerifyCofactored for invalid ones.
+//
+// In groups with a cofactor, such as edwards25519, the random weights cannot
+// be relied upon to cancel small-order components, so the combined equation
+// is compared up to such components: VerifyBatch agrees with
+// VerifyCofactored, not with Verify, and accepts signatures with small-order
+// components that Verify rejects. VerifyBatch panics if the three slices
+// differ in length.
+func VerifyBatch(g kyber.Group, publics []kyber.Point, msgs, sigs [][]byte) []error {
+	if len(publics) != len(msgs) || len(msgs) != len(sigs) {
+		panic("schnorr: mismatched batch lengths")
+	}
+	errs := make([]error, len(sigs))
+	failed := false
+
+	// The batch equation is
+	//   (sum z_i*s_i)*G - sum z_i*R_i - sum (z_i*h_i)*A_i == 0
+	// with random z_i, up to small-order components.
+	scalars := make([]kyber.Scalar, 1, 1+2*len(sigs))
+	points := make([]kyber.Point, 1, 1+2*len(sigs))
+	scalars[0] = g.Scalar().Zero()
+	batch := make([]int, 0, len(sigs))
+	stream := random.New()
+	for i := range sigs {
+		R, s, h, err := parse(g, publics[i], msgs[i], sigs[i])
+		if err != nil {
+			errs[i] = err
+			failed = true
+			continue
+		}
+		if sBuff, err := s.MarshalBinary(); err != nil ||
+			!bytes.Equal(sBuff, sigs[i][R.MarshalSize():]) {
+			// Verify interprets unreduced responses on its own terms,
+			// leave them to it rather than to the batch equation.
+			if errs[i] = VerifyCofactored(g, publics[i], msgs[i], sigs[i]); errs[i] != nil {
+				failed = true
+			}
+			continue
+		}
+
+		z := g.Scalar().Pick(stream)
+		scalars[0].Add(scalars[0], s.Mul(s, z))
+		scalars = append(scalars, g.Scalar().Neg(z), h.Mul(h, z).Neg(h))
+		points = append(points, R, publics[i])
+		batch = append(batch, i)
+	}
+
+	if len(batch) > 0 {
+		sum := msm.Sum(g.Point(), scalars, points)
+		if !equalCofactor(sum, g.Point().Null()) {
+			for _, i := range batch {
+				if errs[i] = VerifyCofactored(g, publics[i], msgs[i], sigs[i]); errs[i] != nil {
+					failed = true
+				}
+			}
+		}
+	}
+
+	if !failed {
+		return nil
+	}
+	return errs
+}
+
+// parse decodes sig into its commitment R and response s, and recomputes
+// the challenge h = hash(public || R || msg).
+func parse(g kyber.Group, public kyber.Point, msg, sig []byte) (kyber.Point, kyber.Scalar, kyber.Scalar, error) {
 	R := g.Point()
 	s := g.Scalar()
 	pointSize := R.MarshalSize()
 	scalarSize := s.MarshalSize()
 	sigSize := scalarSize + pointSize
 	if len(sig) != sigSize {
-		return fmt.Errorf("schnorr: signature of invalid length %d instead of %d", len(sig), sigSize)
+		return nil, nil, nil, fmt.Errorf("schnorr: signature of invalid length %d instead of %d", len(sig), sigSize)
 	}
 	if err := R.UnmarshalBinary(sig[:pointSize]); err != nil {
-		return err
+		return nil, nil, nil, err
 	}
 	if err := s.UnmarshalBinary(sig[pointSize:]); err != nil {
-		return err
+		return nil, nil, nil, err
 	}
 	// recompute hash(public || R || msg)
 	h, err := hash(g, public, R, msg)
 	if err != nil {
-		return err
+		return nil, nil, nil, err
 	}
-
-	// compute S = g^s
-	S := g.Point().Mul(s, nil)
-	// compute RAh = R + A^h
-	Ah := g.Point().Mul(h, public)
-	RAs := g.Point().Add(R, Ah)
-
-	if !S.Equal(RAs) {
-		return errors.New("schnorr: invalid signature")
-	}
-
-	return nil
+	return R, s, h, nil
 }
 
 func hash(g kyber.Group, public, r kyber.Point, msg []byte) (kyber.Scalar, error) {
@@ -1,8 +1,10 @@
 package schnorr
 
 import (
+	"bytes"
 	"testing"
 
+	"github.com/dedis/kyber"
 	"github.com/dedis/kyber/group/edwards25519"
 	"github.com/dedis/kyber/sign/eddsa"
 	"github.com/dedis/kyber/util/key"
@@ -62,3 +64,70 @@ func TestEdDSACompatibility(t *testing.T) {
 	}
 
 }
+
+func TestSchnorrVerifyBatch(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	n := 10
+	publics := make([]kyber.Point, n)
+	msgs := make([][]byte, n)
+	sigs := make([][]byte, n)
+	for i := range sigs {
+		kp := key.NewKeyPair(suite)
+		publics[i] = kp.Public
+		msgs[i] = []byte{byte(i)}
+		s, err := Sign(suite, kp.Private, msgs[i])
+		assert.Nil(t, err)
+		sigs[i] = s
+	}
+	assert.Nil(t, VerifyBatch(suite, publics, msgs, sigs))
+
+	msgs[2] = []byte("wrong message")
+	sigs[5] = append(sigs[5], 0x01)
+	errs := VerifyBatch(suite, publics, msgs, sigs)
+	assert.Len(t, errs, n)
+	for i, err := range errs {
+		if i == 2 || i == 5 {
+			assert.Error(t, err)
+		} else {
+			assert.Nil(t, err)
+		}
+	}
+}
+
+func TestSchnorrVerifyCofactored(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	kp := key.NewKeyPair(suite)
+
+	// The order-2 point (0,-1).
+	T := suite.Point()
+	assert.Nil(t, T.UnmarshalBinary(append([]byte{0xec}, append(bytes.Repeat([]byte{0xff}, 30), 0x7f)...)))
+
+	// Sign with a commitment R = k*G + T.
+	msg := []byte("small-order commitment")
+	k := suite.Scalar().Pick(suite.RandomStream())
+	R := suite.Point().Mul(k, nil)
+	R.Add(R, T)
+	h, err := hash(suite, kp.Public, R, msg)
+	assert.Nil(t, err)
+	s := suite.Scalar().Mul(kp.Private, h)
+	s.Add(s, k)
+	sig, err := R.MarshalBinary()
+	assert.Nil(t, err)
+	sig, err = s.AppendBinary(sig)
+	assert.Nil(t, err)
+
+	assert.Error(t, Verify(suite, kp.Public, msg, sig))
+	assert.Nil(t, VerifyCofactored(suite, kp.Public, msg, sig))
+	sig2, err := Sign(suite, kp.Private, []byte("other"))
+	assert.Nil(t, err)
+	publics := []kyber.Point{kp.Public, kp.Public}
+	msgs := [][]byte{msg, []byte("other")}
+	for i := 0; i < 20; i++ {
+		// The batch must agree with VerifyCofactored whatever the weights.
+		assert.Nil(t, VerifyBatch(suite, publics, msgs, [][]byte{sig, sig2}))
+	}
+	errs := VerifyBatch(suite, publics, msgs, [][]byte{sig, sig})
+	assert.Len(t, errs, 2)
+	assert.Nil(t, errs[0])
+	assert.Error(t, errs[1])
+}
@@ -11,6 +11,7 @@ package suites
 
 import (
 	"errors"
+	"sort"
 	"strings"
 
 	"github.com/dedis/kyber"
@@ -45,6 +46,16 @@ func Find(name string) (Suite, error) {
 	return nil, ErrUnknownSuite
 }
 
+// All returns the registered suites, sorted by name.
+func All() []Suite {
+	all := make([]Suite, 0, len(suites))
+	for _, s := range suites {
+		all = append(all, s)
+	}
+	sort.Slice(all, func(i, j int) bool { return all[i].String() < all[j].String() })
+	return all
+}
+
 // MustFind looks up a suite by name and panics if it is not found.
 func MustFind(name string) Suite {
 	s, err := Find(name)
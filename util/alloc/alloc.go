@@ -0,0 +1,128 @@
+// Package alloc reduces the heap allocations of code handling many points
+// and scalars of a kyber.Group at once. Points and Scalars allocate slices
+// of new values in one go, natively for groups implementing
+// kyber.SliceAllocator, and Pool recycles temporary values between calls.
+package alloc
+
+import (
+	"sync"
+
+	"github.com/dedis/kyber"
+)
+
+// Points returns n new points of g. If g implements kyber.SliceAllocator,
+// they share a single backing array; otherwise they are allocated one by
+// one with g.Point().
+func Points(g kyber.Group, n int) []kyber.Point {
+	if sa, ok := g.(kyber.SliceAllocator); ok {
+		return sa.PointSlice(n)
+	}
+	points := make([]kyber.Point, n)
+	for i := range points {
+		points[i] = g.Point()
+	}
+	return points
+}
+
+// Scalars returns n new scalars of g. If g implements
+// kyber.SliceAllocator, they share a single backing array; otherwise they
+// are allocated one by one with g.Scalar().
+func Scalars(g kyber.Group, n int) []kyber.Scalar {
+	if sa, ok := g.(kyber.SliceAllocator); ok {
+		return sa.ScalarSlice(n)
+	}
+	scalars := make([]kyber.Scalar, n)
+	for i := range scalars {
+		scalars[i] = g.Scalar()
+	}
+	return scalars
+}
+
+// Pool is a sync.Pool of Scratch spaces of one group, so that code called
+// repeatedly, possibly concurrently, can reuse the same temporary points
+// and scalars instead of allocating new ones on every call.
+type Pool struct {
+	g    kyber.Group
+	pool sync.Pool
+}
+
+// NewPool returns a Pool of Scratch spaces of g.
+func NewPool(g kyber.Group) *Pool {
+	return &Pool{g: g}
+}
+
+// Get returns a Scratch space from the pool, or a new one if it is empty.
+func (p *Pool) Get() *Scratch {
+	if s, ok := p.pool.Get().(*Scratch); ok {
+		return s
+	}
+	return &Scratch{g: p.g}
+}
+
+// Put returns s to the pool. The values s handed out must no longer be
+// used.
+func (p *Pool) Put(s *Scratch) {
+	s.Reset()
+	p.pool.Put(s)
+}
+
+// Scratch hands out temporary points and scalars of one group. Its values
+// are recycled when the Scratch is Reset or put back into its Pool, so
+// they must not outlive that. A Scratch is not safe for concurrent use.
+type Scratch struct {
+	g       kyber.Group
+	points  []kyber.Point
+	scalars []kyber.Scalar
+	np, ns  int // number of points and scalars handed out
+}
+
+// NewScratch returns an empty Scratch space of g.
+func NewScratch(g kyber.Group) *Scratch {
+	return &Scratch{g: g}
+}
+
+// Points returns n temporary points, holding arbitrary values.
+func (s *Scratch) Points(n int) []kyber.Point {
+	if s.np+n > len(s.points) {
+		s.points = append(s.points, Points(s.g, grow(len(s.points), s.np+n))...)
+	}
+	p := s.points[s.np : s.np+n : s.np+n]
+	s.np += n
+	return p
+}
+
+// Scalars returns n temporary scalars, holding arbitrary values.
+func (s *Scratch) Scalars(n int) []kyber.Scalar {
+	if s.ns+n > len(s.scalars) {
+		s.scalars = append(s.scalars, Scalars(s.g, grow(len(s.scalars), s.ns+n))...)
+	}
+	sc := s.scalars[s.ns : s.ns+n : s.ns+n]
+	s.ns += n
+	return sc
+}
+
+// Point returns a temporary point, holding an arbitrary value.
+func (s *Scratch) Point() kyber.Point {
+	return s.Points(1)[0]
+}
+
+// Scalar returns a temporary scalar, holding an arbitrary value.
+func (s *Scratch) Scalar() kyber.Scalar {
+	return s.Scalars(1)[0]
+}
+
+// Reset makes all the values handed out by s available again.
+func (s *Scratch) Reset() {
+	s.np, s.ns = 0, 0
+}
+
+// grow returns the number of values to add to a scratch of size have for
+// it to hold at least need, doubling its size so that a scratch reaches
+// its working size in a few steps.
+func grow(have, need int) int {
+	n := have
+	if n < need-have {
+		n = need - have
+	}
+	return n
+}
@@ -0,0 +1,70 @@
+package alloc
+
+import (
+	"testing"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/group/edwards25519"
+	"github.com/dedis/kyber/internal/race"
+	"github.com/stretchr/testify/require"
+)
+
+var suite = edwards25519.NewBlakeSHA256Ed25519()
+
+// plainGroup hides the kyber.SliceAllocator implementation of a group.
+type plainGroup struct {
+	kyber.Group
+}
+
+func TestSlices(t *testing.T) {
+	for _, g := range []kyber.Group{suite, plainGroup{suite}} {
+		points := Points(g, 3)
+		scalars := Scalars(g, 3)
+		require.Equal(t, 3, len(points))
+		require.Equal(t, 3, len(scalars))
+		for i := range points {
+			scalars[i].SetInt64(int64(i + 1))
+			points[i].Mul(scalars[i], nil)
+		}
+		// The values are distinct.
+		two := g.Scalar().SetInt64(2)
+		require.True(t, points[1].Equal(g.Point().Mul(two, nil)))
+		require.True(t, scalars[1].Equal(two))
+		require.False(t, points[0].Equal(points[1]))
+	}
+	require.Equal(t, 2.0, testing.AllocsPerRun(10, func() { Points(suite, 100) }))
+	require.Equal(t, 2.0, testing.AllocsPerRun(10, func() { Scalars(suite, 100) }))
+}
+
+func TestScratch(t *testing.T) {
+	s := NewScratch(suite)
+	a := s.Scalars(2)
+	b := s.Scalars(5)
+	P := s.Point()
+	require.Equal(t, 2, len(a))
+	require.Equal(t, 5, len(b))
+	a[1].SetInt64(1)
+	b[0].SetInt64(2)
+	require.False(t, a[1].Equal(b[0]))
+	require.Equal(t, 2, cap(a))
+	P.Base()
+
+	// After a reset, the same values are handed out again.
+	s.Reset()
+	require.True(t, s.Scalars(2)[1] == a[1])
+	require.True(t, s.Point() == P)
+
+	// sync.Pool drops items at random under the race detector.
+	if race.Enabled {
+		return
+	}
+	pool := NewPool(suite)
+	pool.Put(pool.Get())
+	allocs := testing.AllocsPerRun(100, func() {
+		sc := pool.Get()
+		sc.Scalars(10)
+		sc.Points(10)
+		pool.Put(sc)
+	})
+	require.True(t, allocs < 1, "allocs per reuse:", allocs)
+}
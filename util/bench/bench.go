@@ -0,0 +1,396 @@
+// Package bench defines benchmarks of the hot primitives of kyber, for every
+// suite registered in package suites, under stable names so that results can
+// be compared from one commit to the next. The go test benchmarks of this
+// package run them all, e.g.
+//
+//	go test -tags vartime -bench . -benchmem ./util/bench
+//
+// and cmd/kyberbench runs them with machine-readable output.
+package bench
+
+import (
+	"fmt"
+	"sync"
+	"testing"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/share"
+	dkg "github.com/dedis/kyber/share/dkg/pedersen"
+	"github.com/dedis/kyber/share/pvss"
+	vss "github.com/dedis/kyber/share/vss/pedersen"
+	"github.com/dedis/kyber/sign/cosi"
+	"github.com/dedis/kyber/sign/eddsa"
+	"github.com/dedis/kyber/sign/schnorr"
+	"github.com/dedis/kyber/suites"
+	"github.com/dedis/kyber/util/random"
+)
+
+// A Benchmark is a single named measurement. Names have the form
+// Suite/Area/Operation[/size].
+type Benchmark struct {
+	Name string
+	F    func(b *testing.B)
+}
+
+// suiteNames lists the suites to benchmark, in order. Suites not compiled
+// in, such as those requiring the vartime build tag, are skipped.
+var suiteNames = []string{"Ed25519", "Curve25519", "Curve25519-full", "P256", "Residue512"}
+
+// extra holds the benchmarks of packages behind build tags, such as the
+// experimental shuffles, which register themselves at init.
+var extra []func(large bool) []Benchmark
+
+// protocolSizes are the numbers of participants of the VSS, DKG, PVSS and
+// CoSi benchmarks; the large ones take minutes of setup.
+func protocolSizes(large bool) []int {
+	if large {
+		return []int{16, 64, 256, 1024}
+	}
+	return []int{16, 64}
+}
+
+// All returns the benchmarks of all available suites. If large is set, it
+// includes the protocol sizes beyond 64 participants.
+func All(large bool) []Benchmark {
+	var all []Benchmark
+	for _, name := range suiteNames {
+		s, err := suites.Find(name)
+		if err != nil {
+			continue
+		}
+		all = append(all, groupBenchmarks(s)...)
+		all = append(all, signBenchmarks(s)...)
+		all = append(all, shareBenchmarks(s, large)...)
+	}
+	for _, f := range extra {
+		all = append(all, f(large)...)
+	}
+	for i := range all {
+		f := all[i].F
+		all[i].F = func(b *testing.B) {
+			b.ReportAllocs()
+			f(b)
+		}
+	}
+	return all
+}
+
+func groupBenchmarks(s suites.Suite) []Benchmark {
+	rng := random.New()
+	x, y := s.Scalar().Pick(rng), s.Scalar().Pick(rng)
+	X, Y := s.Point().Pick(rng), s.Point().Pick(rng)
+	xe, _ := x.MarshalBinary()
+	Xe, _ := X.MarshalBinary()
+	z, Z := s.Scalar(), s.Point()
+	var buf []byte
+	name := s.String()
+	return []Benchmark{
+		{name + "/Scalar/Add", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				z.Add(x, y)
+			}
+		}},
+		{name + "/Scalar/Mul", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				z.Mul(x, y)
+			}
+		}},
+		{name + "/Scalar/Inv", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				z.Inv(x)
+			}
+		}},
+		{name + "/Scalar/Pick", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				z.Pick(rng)
+			}
+		}},
+		{name + "/Scalar/Marshal", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				buf, _ = x.AppendBinary(buf[:0])
+			}
+		}},
+		{name + "/Scalar/Unmarshal", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				_ = z.UnmarshalBinary(xe)
+			}
+		}},
+		{name + "/Point/Add", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				Z.Add(X, Y)
+			}
+		}},
+		{name + "/Point/Mul", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				Z.Mul(x, X)
+			}
+		}},
+		{name + "/Point/BaseMul", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				Z.Mul(x, nil)
+			}
+		}},
+		{name + "/Point/Pick", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				Z.Pick(rng)
+			}
+		}},
+		{name + "/Point/Marshal", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				buf, _ = X.AppendBinary(buf[:0])
+			}
+		}},
+		{name + "/Point/Unmarshal", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				_ = Z.UnmarshalBinary(Xe)
+			}
+		}},
+	}
+}
+
+func signBenchmarks(s suites.Suite) []Benchmark {
+	msg := []byte("Hello World")
+	x := s.Scalar().Pick(s.RandomStream())
+	X := s.Point().Mul(x, nil)
+	sig, err := schnorr.Sign(s, x, msg)
+	if err != nil {
+		panic(err)
+	}
+	name := s.String()
+	bms := []Benchmark{
+		{name + "/Schnorr/Sign", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				_, _ = schnorr.Sign(s, x, msg)
+			}
+		}},
+		{name + "/Schnorr/Verify", func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				if err := schnorr.Verify(s, X, msg, sig); err != nil {
+					b.Fatal(err)
+				}
+			}
+		}},
+	}
+
+	if name == "Ed25519" {
+		ed := eddsa.NewEdDSA(random.New())
+		edSig, _ := ed.Sign(msg)
+		bms = append(bms,
+			Benchmark{name + "/EdDSA/Sign", func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					_, _ = ed.Sign(msg)
+				}
+			}},
+			Benchmark{name + "/EdDSA/Verify", func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					if err := eddsa.Verify(ed.Public, msg, edSig); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}})
+	}
+
+	for _, n := range []int{16, 128} {
+		n := n
+		bms = append(bms,
+			Benchmark{fmt.Sprintf("%s/CoSi/Sign/%d", name, n), func(b *testing.B) {
+				privates, publics := keys(s, n)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					cosign(s, privates, publics, msg)
+				}
+			}},
+			Benchmark{fmt.Sprintf("%s/CoSi/Verify/%d", name, n), func(b *testing.B) {
+				privates, publics := keys(s, n)
+				cosig := cosign(s, privates, publics, msg)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					if err := cosi.Verify(s, publics, msg, cosig, nil); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}})
+	}
+	return bms
+}
+
+// cosign runs a CoSi round of all the given signers on msg, without the
+// communication, and returns the collective signature.
+func cosign(s suites.Suite, privates []kyber.Scalar, publics []kyber.Point, msg []byte) []byte {
+	n := len(privates)
+	v := make([]kyber.Scalar, n)
+	V := make([]kyber.Point, n)
+	masks := make([][]byte, n)
+	full, err := cosi.NewMask(s, publics, nil)
+	if err != nil {
+		panic(err)
+	}
+	for i := range v {
+		v[i], V[i] = cosi.Commit(s)
+		m, _ := cosi.NewMask(s, publics, publics[i])
+		masks[i] = m.Mask()
+	}
+	aggV, aggMask, err := cosi.AggregateCommitments(s, V, masks)
+	if err != nil {
+		panic(err)
+	}
+	if err := full.SetMask(aggMask); err != nil {
+		panic(err)
+	}
+	c, err := cosi.Challenge(s, aggV, full.AggregatePublic, msg)
+	if err != nil {
+		panic(err)
+	}
+	r := make([]kyber.Scalar, n)
+	for i := range r {
+		r[i], _ = cosi.Response(s, privates[i], v[i], c)
+	}
+	aggr, err := cosi.AggregateResponses(s, r)
+	if err != nil {
+		panic(err)
+	}
+	sig, err := cosi.Sign(s, aggV, aggr, full)
+	if err != nil {
+		panic(err)
+	}
+	return sig
+}
+
+type keyPairs struct {
+	privates []kyber.Scalar
+	publics  []kyber.Point
+}
+
+var keyCache = struct {
+	sync.Mutex
+	m map[string]keyPairs
+}{m: make(map[string]keyPairs)}
+
+// keys returns n key pairs of s, generated once and shared by all the
+// benchmarks, so that only the benchmarks selected to run pay for them.
+func keys(s suites.Suite, n int) ([]kyber.Scalar, []kyber.Point) {
+	keyCache.Lock()
+	defer keyCache.Unlock()
+	id := fmt.Sprintf("%s/%d", s.String(), n)
+	kp, ok := keyCache.m[id]
+	if !ok {
+		kp.privates = make([]kyber.Scalar, n)
+		kp.publics = make([]kyber.Point, n)
+		for i := range kp.privates {
+			kp.privates[i] = s.Scalar().Pick(s.RandomStream())
+			kp.publics[i] = s.Point().Mul(kp.privates[i], nil)
+		}
+		keyCache.m[id] = kp
+	}
+	return kp.privates, kp.publics
+}
+
+func shareBenchmarks(s suites.Suite, large bool) []Benchmark {
+	var bms []Benchmark
+	name := s.String()
+	for _, n := range protocolSizes(large) {
+		n, t := n, vss.MinimumT(n)
+		dealerKey := s.Scalar().Pick(s.RandomStream())
+		dealerPub := s.Point().Mul(dealerKey, nil)
+		bms = append(bms,
+			Benchmark{fmt.Sprintf("%s/VSS/Deal/%d", name, n), func(b *testing.B) {
+				_, publics := keys(s, n)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					d, err := vss.NewDealer(s, dealerKey, s.Scalar().Pick(s.RandomStream()), publics, t)
+					if err != nil {
+						b.Fatal(err)
+					}
+					if _, err := d.EncryptedDeals(); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}},
+			Benchmark{fmt.Sprintf("%s/VSS/Verify/%d", name, n), func(b *testing.B) {
+				privates, publics := keys(s, n)
+				d, _ := vss.NewDealer(s, dealerKey, s.Scalar().Pick(s.RandomStream()), publics, t)
+				deal, _ := d.EncryptedDeal(0)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					v, err := vss.NewVerifier(s, privates[0], dealerPub, publics)
+					if err != nil {
+						b.Fatal(err)
+					}
+					if _, err := v.ProcessEncryptedDeal(deal); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}},
+			Benchmark{fmt.Sprintf("%s/DKG/Deals/%d", name, n), func(b *testing.B) {
+				privates, publics := keys(s, n)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					g, err := dkg.NewDistKeyGenerator(s, privates[0], publics, t)
+					if err != nil {
+						b.Fatal(err)
+					}
+					if _, err := g.Deals(); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}})
+		if n <= 256 {
+			bms = append(bms, Benchmark{fmt.Sprintf("%s/DKG/ProcessDeals/%d", name, n), func(b *testing.B) {
+				privates, publics := keys(s, n)
+				deals := make([]*dkg.Deal, 0, n-1)
+				for j := 1; j < n; j++ {
+					g, _ := dkg.NewDistKeyGenerator(s, privates[j], publics, t)
+					all, _ := g.Deals()
+					deals = append(deals, all[0])
+				}
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					b.StopTimer()
+					g, _ := dkg.NewDistKeyGenerator(s, privates[0], publics, t)
+					b.StartTimer()
+					if _, errs := g.ProcessDeals(deals); errs != nil {
+						for _, err := range errs {
+							if err != nil {
+								b.Fatal(err)
+							}
+						}
+					}
+				}
+			}})
+		}
+
+		H := s.Point().Pick(s.XOF([]byte("H")))
+		bms = append(bms,
+			Benchmark{fmt.Sprintf("%s/PVSS/EncShares/%d", name, n), func(b *testing.B) {
+				_, publics := keys(s, n)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					if _, _, err := pvss.EncShares(s, H, publics, nil, t); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}},
+			Benchmark{fmt.Sprintf("%s/PVSS/VerifyEncShares/%d", name, n), func(b *testing.B) {
+				_, publics := keys(s, n)
+				encShares, pubPoly, _ := pvss.EncShares(s, H, publics, nil, t)
+				sH := pubShares(pubPoly, n)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					_, good, err := pvss.VerifyEncShareBatch(s, H, publics, sH, encShares)
+					if err != nil || len(good) != n {
+						b.Fatal("invalid encrypted shares", err)
+					}
+				}
+			}})
+	}
+	return bms
+}
+
+func pubShares(p *share.PubPoly, n int) []kyber.Point {
+	shares := p.Shares(n)
+	sH := make([]kyber.Point, n)
+	for i, sh := range shares {
+		sH[i] = sh.V
+	}
+	return sH
+}
@@ -0,0 +1,63 @@
+package bench
+
+import (
+	"flag"
+	"path"
+	"strconv"
+	"testing"
+)
+
+var large = flag.Bool("large", false, "also run the protocol benchmarks beyond 64 participants")
+
+func BenchmarkKyber(b *testing.B) {
+	for _, bm := range All(*large) {
+		b.Run(bm.Name, bm.F)
+	}
+}
+
+func TestNames(t *testing.T) {
+	seen := make(map[string]bool)
+	for _, bm := range All(true) {
+		if seen[bm.Name] {
+			t.Fatal("duplicate benchmark", bm.Name)
+		}
+		seen[bm.Name] = true
+	}
+	if !seen["Ed25519/Point/Mul"] {
+		t.Fatal("missing Ed25519 benchmarks")
+	}
+}
+
+// TestRunOnce runs every benchmark once, at the smallest size of those
+// taking one, so that broken benchmarks fail the tests.
+func TestRunOnce(t *testing.T) {
+	if testing.Short() {
+		t.Skip("running the benchmarks takes a while")
+	}
+	benchtime := flag.Lookup("test.benchtime").Value
+	old := benchtime.String()
+	if err := benchtime.Set("1x"); err != nil {
+		t.Fatal(err)
+	}
+	defer benchtime.Set(old)
+
+	all := All(false)
+	smallest := make(map[string]int)
+	for _, bm := range all {
+		if n, err := strconv.Atoi(path.Base(bm.Name)); err == nil {
+			dir := path.Dir(bm.Name)
+			if m, ok := smallest[dir]; !ok || n < m {
+				smallest[dir] = n
+			}
+		}
+	}
+	for _, bm := range all {
+		if n, err := strconv.Atoi(path.Base(bm.Name)); err == nil && n != smallest[path.Dir(bm.Name)] {
+			continue
+		}
+		// A failed benchmark reports no iterations.
+		if r := testing.Benchmark(bm.F); r.N == 0 {
+			t.Error("benchmark failed:", bm.Name)
+		}
+	}
+}
@@ -0,0 +1,64 @@
+// +build experimental
+
+package bench
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/group/edwards25519"
+	"github.com/dedis/kyber/proof"
+	"github.com/dedis/kyber/shuffle"
+	"github.com/dedis/kyber/xof/blake"
+)
+
+func init() {
+	extra = append(extra, shuffleBenchmarks)
+}
+
+// shuffleBenchmarks measures Neff shuffles of k ElGamal pairs. Their proofs
+// need an XOF as random stream, so they only run on Ed25519.
+func shuffleBenchmarks(large bool) []Benchmark {
+	sizes := []int{16, 128, 1024}
+	if large {
+		sizes = append(sizes, 10000)
+	}
+	s := edwards25519.NewBlakeSHA256Ed25519WithRand(blake.New(nil))
+	rand := s.RandomStream()
+	var bms []Benchmark
+	for _, k := range sizes {
+		k := k
+		H := s.Point().Mul(s.Scalar().Pick(rand), nil)
+		X := make([]kyber.Point, k)
+		Y := make([]kyber.Point, k)
+		for i := range X {
+			X[i] = s.Point().Pick(rand)
+			Y[i] = s.Point().Pick(rand)
+		}
+		bms = append(bms,
+			Benchmark{fmt.Sprintf("Ed25519/Shuffle/Prove/%d", k), func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					_, _, prover := shuffle.Shuffle(s, nil, H, X, Y, rand)
+					if _, err := proof.HashProve(s, "PairShuffle", prover); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}},
+			Benchmark{fmt.Sprintf("Ed25519/Shuffle/Verify/%d", k), func(b *testing.B) {
+				Xbar, Ybar, prover := shuffle.Shuffle(s, nil, H, X, Y, rand)
+				prf, err := proof.HashProve(s, "PairShuffle", prover)
+				if err != nil {
+					b.Fatal(err)
+				}
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					verifier := shuffle.Verifier(s, nil, H, X, Y, Xbar, Ybar)
+					if err := proof.HashVerify(s, "PairShuffle", verifier, prf); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}})
+	}
+	return bms
+}
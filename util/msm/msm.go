@@ -0,0 +1,41 @@
+// Package msm provides multi-scalar multiplication, i.e. the computation of
+// linear combinations of points s[0]*P[0] + ... + s[n-1]*P[n-1], for any
+// kyber.Group. Groups implementing kyber.MultiScalarMultiplier get their
+// native, faster implementation; all others fall back to Mul and Add.
+//
+// Native implementations may run in variable time, so these functions
+// must only be used on public scalars and points.
+package msm
+
+import (
+	"github.com/dedis/kyber"
+)
+
+// Sum sets dst to the sum of scalars[i]*points[i] and returns it. A nil
+// point stands for the standard base point, as in kyber.Point.Mul.
+// dst may alias one of the given points. Sum panics if scalars and
+// points differ in length.
+func Sum(dst kyber.Point, scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("msm: mismatched number of scalars and points")
+	}
+	if m, ok := dst.(kyber.MultiScalarMultiplier); ok {
+		return m.MultiScalarMul(scalars, points)
+	}
+	return Generic(dst, scalars, points)
+}
+
+// Generic computes the same result as Sum using only the kyber.Point
+// interface, regardless of whether dst implements kyber.MultiScalarMultiplier.
+func Generic(dst kyber.Point, scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("msm: mismatched number of scalars and points")
+	}
+	acc := dst.Clone().Null()
+	tmp := dst.Clone()
+	for i := range scalars {
+		tmp.Mul(scalars[i], points[i])
+		acc.Add(acc, tmp)
+	}
+	return dst.Set(acc)
+}
@@ -0,0 +1,59 @@
+package msm
+
+import (
+	"testing"
+
+	"github.com/dedis/kyber"
+	"github.com/dedis/kyber/group/edwards25519"
+	"github.com/stretchr/testify/require"
+)
+
+var suite = edwards25519.NewBlakeSHA256Ed25519()
+
+func randomTerms(n int) ([]kyber.Scalar, []kyber.Point) {
+	scalars := make([]kyber.Scalar, n)
+	points := make([]kyber.Point, n)
+	for i := range points {
+		scalars[i] = suite.Scalar().Pick(suite.RandomStream())
+		points[i] = suite.Point().Pick(suite.RandomStream())
+	}
+	return scalars, points
+}
+
+func TestSum(t *testing.T) {
+	for _, n := range []int{0, 1, 7, 189, 190, 700} {
+		scalars, points := randomTerms(n)
+		require.True(t, Generic(suite.Point(), scalars, points).Equal(
+			Sum(suite.Point(), scalars, points)), "n = ", n)
+	}
+}
+
+func TestSumAlias(t *testing.T) {
+	scalars, points := randomTerms(3)
+	exp := Generic(suite.Point(), scalars, points)
+	for _, f := range []func(kyber.Point, []kyber.Scalar, []kyber.Point) kyber.Point{Sum, Generic} {
+		aliased := []kyber.Point{points[0].Clone(), points[1], points[2]}
+		require.True(t, exp.Equal(f(aliased[0], scalars, aliased)))
+	}
+}
+
+func TestSumMismatch(t *testing.T) {
+	scalars, points := randomTerms(3)
+	require.Panics(t, func() { Sum(suite.Point(), scalars, points[:2]) })
+}
+
+func benchmarkSum(b *testing.B, n int, f func(kyber.Point, []kyber.Scalar, []kyber.Point) kyber.Point) {
+	scalars, points := randomTerms(n)
+	dst := suite.Point()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		f(dst, scalars, points)
+	}
+}
+
+func BenchmarkSum16(b *testing.B)       { benchmarkSum(b, 16, Sum) }
+func BenchmarkSum256(b *testing.B)      { benchmarkSum(b, 256, Sum) }
+func BenchmarkSum1024(b *testing.B)     { benchmarkSum(b, 1024, Sum) }
+func BenchmarkGeneric16(b *testing.B)   { benchmarkSum(b, 16, Generic) }
+func BenchmarkGeneric256(b *testing.B)  { benchmarkSum(b, 256, Generic) }
+func BenchmarkGeneric1024(b *testing.B) { benchmarkSum(b, 1024, Generic) }
@@ -0,0 +1,130 @@
+package random
+
+import (
+	"crypto/rand"
+	"encoding/binary"
+	"math/bits"
+	"sync"
+)
+
+const (
+	// drbgBlocks is the number of ChaCha20 blocks generated per refill.
+	drbgBlocks = 16
+	// drbgReseed is the number of bytes a drbg outputs before it mixes
+	// fresh entropy from crypto/rand into its key.
+	drbgReseed = 1 << 20
+)
+
+// drbg is a deterministic random bit generator following the "fast key
+// erasure" design of D. J. Bernstein, https://blog.cr.yp.to/20170723-random.html.
+// Each refill runs ChaCha20 under the current key, replaces the key with
+// the first 32 bytes of output and hands out the rest, erasing bytes as
+// they are consumed, so that a later compromise of the state reveals
+// nothing about earlier output.
+//
+// A drbg is not safe for concurrent use; randstream keeps them in a
+// sync.Pool, which hands each goroutine its own.
+type drbg struct {
+	key  [8]uint32
+	buf  [drbgBlocks * 64]byte
+	pos  int // next unread byte of buf
+	left int // bytes to output before the next reseed
+}
+
+var drbgPool = sync.Pool{
+	New: func() interface{} {
+		g := &drbg{}
+		g.pos = len(g.buf)
+		return g
+	},
+}
+
+// reseed mixes 32 bytes from crypto/rand into the key.
+func (g *drbg) reseed() {
+	var seed [32]byte
+	n, err := rand.Read(seed[:])
+	if err != nil {
+		panic(err)
+	}
+	if n < len(seed) {
+		panic("short read on infinite random stream!?")
+	}
+	for i := range g.key {
+		g.key[i] ^= binary.LittleEndian.Uint32(seed[4*i:])
+	}
+	g.left = drbgReseed
+}
+
+// refill generates a fresh buffer of output and rotates the key.
+func (g *drbg) refill() {
+	if g.left <= 0 {
+		g.reseed()
+	}
+	for i := 0; i < drbgBlocks; i++ {
+		chachaBlock(g.buf[64*i:], &g.key, &[4]uint32{uint32(i)})
+	}
+	for i := range g.key {
+		g.key[i] = binary.LittleEndian.Uint32(g.buf[4*i:])
+	}
+	for i := 0; i < 32; i++ {
+		g.buf[i] = 0
+	}
+	g.pos = 32
+	g.left -= len(g.buf) - 32
+}
+
+// xorKeyStream sets dst = src XOR output, for slices of equal length.
+func (g *drbg) xorKeyStream(dst, src []byte) {
+	for len(dst) > 0 {
+		if g.pos == len(g.buf) {
+			g.refill()
+		}
+		b := g.buf[g.pos:]
+		if len(b) > len(dst) {
+			b = b[:len(dst)]
+		}
+		for i := range b {
+			dst[i] = src[i] ^ b[i]
+			b[i] = 0
+		}
+		g.pos += len(b)
+		dst, src = dst[len(b):], src[len(b):]
+	}
+}
+
+// chachaBlock writes the 64-byte ChaCha20 block (RFC 7539) for the given
+// key and last four state words, i.e. the counter and nonce, to out.
+func chachaBlock(out []byte, key *[8]uint32, in *[4]uint32) {
+	s := [16]uint32{
+		0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+		key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+		in[0], in[1], in[2], in[3],
+	}
+	x := s
+	for i := 0; i < 10; i++ {
+		x[0], x[4], x[8], x[12] = chachaQR(x[0], x[4], x[8], x[12])
+		x[1], x[5], x[9], x[13] = chachaQR(x[1], x[5], x[9], x[13])
+		x[2], x[6], x[10], x[14] = chachaQR(x[2], x[6], x[10], x[14])
+		x[3], x[7], x[11], x[15] = chachaQR(x[3], x[7], x[11], x[15])
+		x[0], x[5], x[10], x[15] = chachaQR(x[0], x[5], x[10], x[15])
+		x[1], x[6], x[11], x[12] = chachaQR(x[1], x[6], x[11], x[12])
+		x[2], x[7], x[8], x[13] = chachaQR(x[2], x[7], x[8], x[13])
+		x[3], x[4], x[9], x[14] = chachaQR(x[3], x[4], x[9], x[14])
+	}
+	for i := range x {
+		binary.LittleEndian.PutUint32(out[4*i:], x[i]+s[i])
+	}
+}
+
+// chachaQR is the ChaCha quarter round.
+func chachaQR(a, b, c, d uint32) (uint32, uint32, uint32, uint32) {
+	a += b
+	d = bits.RotateLeft32(d^a, 16)
+	c += d
+	b = bits.RotateLeft32(b^c, 12)
+	a += b
+	d = bits.RotateLeft32(d^a, 8)
+	c += d
+	b = bits.RotateLeft32(b^c, 7)
+	return a, b, c, d
+}
@@ -4,7 +4,6 @@ package random
 
 import (
 	"crypto/cipher"
-	"crypto/rand"
 	"math/big"
 )
 
@@ -44,35 +43,29 @@ func Bytes(b []byte, rand cipher.Stream) {
 	rand.XORKeyStream(b, b)
 }
 
+// randstream is a cipher.Stream drawing from pooled drbg states, so that
+// concurrent callers neither contend on a lock nor make a system call
+// for every read.
 type randstream struct {
 }
 
 func (r *randstream) XORKeyStream(dst, src []byte) {
-	// This function works only on local data, so it is
-	// safe against race conditions, as long as crypto/rand
-	// is as well. (It is.)
-
-	l := len(dst)
-	if len(src) != l {
+	if len(src) != len(dst) {
 		panic("XORKeyStream: mismatched buffer lengths")
 	}
 
-	buf := make([]byte, l)
-	n, err := rand.Read(buf)
-	if err != nil {
-		panic(err)
-	}
-	if n < len(buf) {
-		panic("short read on infinite random stream!?")
-	}
-
-	for i := 0; i < l; i++ {
-		dst[i] = src[i] ^ buf[i]
-	}
+	g := drbgPool.Get().(*drbg)
+	g.xorKeyStream(dst, src)
+	drbgPool.Put(g)
 }
 
-// New returns a new cipher.Stream that gets random data from Go's crypto/rand package.
+// New returns a new cipher.Stream of cryptographically secure random data.
+// It expands seeds from Go's crypto/rand package with ChaCha20, reseeding
+// every megabyte of output.
 // The resulting cipher.Stream can be used in multiple threads.
+//
+// Go programs cannot fork without exec, so no two processes ever share
+// a generator state.
 func New() cipher.Stream {
 	return &randstream{}
 }
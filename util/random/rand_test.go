@@ -0,0 +1,95 @@
+package random
+
+import (
+	"bytes"
+	"encoding/hex"
+	"sync"
+	"testing"
+)
+
+// Test vector from RFC 7539, section 2.3.2.
+func TestChachaBlock(t *testing.T) {
+	var key [8]uint32
+	for i := range key {
+		b := byte(4 * i)
+		key[i] = uint32(b) | uint32(b+1)<<8 | uint32(b+2)<<16 | uint32(b+3)<<24
+	}
+	out := make([]byte, 64)
+	chachaBlock(out, &key, &[4]uint32{1, 0x09000000, 0x4a000000, 0})
+	want := "10f1e7e4d13b5915500fdd1fa32071c4c7d1f4c733c068030422aa9ac3d46c4e" +
+		"d2826446079faa0914c2d705d98b02a2b5129cd1de164eb9cbd083e8a2503c4e"
+	if hex.EncodeToString(out) != want {
+		t.Fatalf("got %x", out)
+	}
+}
+
+func TestStream(t *testing.T) {
+	rand := New()
+
+	// Reads of all sizes, crossing refills and reseeds.
+	seen := make(map[string]bool)
+	for n := 1; n < 3*drbgReseed; n = n*3 + 1 {
+		b := make([]byte, n)
+		Bytes(b, rand)
+		if n >= 16 {
+			k := string(b[:16])
+			if seen[k] {
+				t.Fatal("repeated output")
+			}
+			seen[k] = true
+		}
+	}
+
+	// XORing into a non-zero source.
+	src := bytes.Repeat([]byte{0xff}, 4096)
+	dst := make([]byte, len(src))
+	rand.XORKeyStream(dst, src)
+	if bytes.Equal(dst, src) {
+		t.Fatal("stream left its input unchanged")
+	}
+}
+
+func TestStreamConcurrent(t *testing.T) {
+	rand := New()
+	var wg sync.WaitGroup
+	out := make([][]byte, 8)
+	for i := range out {
+		wg.Add(1)
+		go func(i int) {
+			defer wg.Done()
+			out[i] = make([]byte, 32)
+			for j := 0; j < 1000; j++ {
+				Bytes(out[i], rand)
+			}
+		}(i)
+	}
+	wg.Wait()
+	for i := range out {
+		for j := 0; j < i; j++ {
+			if bytes.Equal(out[i], out[j]) {
+				t.Fatal("goroutines got the same output")
+			}
+		}
+	}
+}
+
+func BenchmarkStream32(b *testing.B) {
+	rand := New()
+	buf := make([]byte, 32)
+	b.SetBytes(32)
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		rand.XORKeyStream(buf, buf)
+	}
+}
+
+func BenchmarkStream32Parallel(b *testing.B) {
+	rand := New()
+	b.SetBytes(32)
+	b.RunParallel(func(pb *testing.PB) {
+		buf := make([]byte, 32)
+		for pb.Next() {
+			rand.XORKeyStream(buf, buf)
+		}
+	})
+}
@@ -6,6 +6,7 @@ import (
 
 	"github.com/dedis/kyber"
 	"github.com/dedis/kyber/util/key"
+	"github.com/dedis/kyber/util/msm"
 	"github.com/dedis/kyber/util/random"
 )
 
@@ -130,6 +131,56 @@ func testScalarClone(g kyber.Group, rand cipher.Stream) {
 	}
 }
 
+func testMultiScalarMul(g kyber.Group, rand cipher.Stream) {
+	for _, n := range []int{0, 1, 2, 5, 250} {
+		scalars := make([]kyber.Scalar, n)
+		points := make([]kyber.Point, n)
+		for i := range points {
+			scalars[i] = g.Scalar().Pick(rand)
+			points[i] = g.Point().Pick(rand)
+		}
+		if n > 1 {
+			points[1] = nil // standard base point
+			scalars[0].Zero()
+		}
+		p1 := g.Point().(kyber.MultiScalarMultiplier).MultiScalarMul(scalars, points)
+		p2 := msm.Generic(g.Point(), scalars, points)
+		if !p1.Equal(p2) {
+			panic("MultiScalarMul differs from Mul and Add")
+		}
+	}
+}
+
+func testPrecompute(g kyber.Group, rand cipher.Stream) {
+	P := g.Point().Pick(rand)
+	s := g.Scalar().Pick(rand)
+	exp := g.Point().Mul(s, P)
+	P.(kyber.Precomputable).Precompute()
+	if !g.Point().Mul(s, P).Equal(exp) || !g.Point().Mul(s, P.Clone()).Equal(exp) {
+		panic("Mul with a precomputed point gives a different result")
+	}
+	P.Add(P, P)
+	exp.Add(exp, exp)
+	if !g.Point().Mul(s, P).Equal(exp) {
+		panic("Mul with a modified precomputed point gives a different result")
+	}
+}
+
+func testAppendBinary(g kyber.Group, rand cipher.Stream) {
+	prefix := []byte("prefix")
+	for _, o := range []kyber.Marshaling{g.Point().Null(), g.Point().Pick(rand),
+		g.Scalar().Zero(), g.Scalar().Pick(rand)} {
+		exp, _ := o.MarshalBinary()
+		b, err := o.AppendBinary(append([]byte{}, prefix...))
+		if err != nil {
+			panic(err)
+		}
+		if !bytes.Equal(b[:len(prefix)], prefix) || !bytes.Equal(b[len(prefix):], exp) {
+			panic("AppendBinary differs from MarshalBinary")
+		}
+	}
+}
+
 // Apply a generic set of validation tests to a cryptographic Group,
 // using a given source of [pseudo-]randomness.
 //
@@ -332,6 +383,14 @@ func testGroup(g kyber.Group, rand cipher.Stream) []kyber.Point {
 		panic(err)
 	}
 
+	if _, ok := g.Point().(kyber.MultiScalarMultiplier); ok {
+		testMultiScalarMul(g, rand)
+	}
+	if _, ok := g.Point().(kyber.Precomputable); ok {
+		testPrecompute(g, rand)
+	}
+
+	testAppendBinary(g, rand)
 	testPointSet(g, rand)
 	testPointClone(g, rand)
 	testScalarSet(g, rand)
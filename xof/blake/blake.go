@@ -16,6 +16,12 @@ type xof struct {
 
 // New creates a new XOF using the Blake2b hash.
 func New(seed []byte) kyber.XOF {
+	return &xof{impl: newImpl(seed)}
+}
+
+// newImpl returns a Blake2b XOF keyed with the first blake2b.Size bytes of
+// seed, having absorbed the rest.
+func newImpl(seed []byte) blake2b.XOF {
 	seed1 := seed
 	var seed2 []byte
 	if len(seed) > blake2b.Size {
@@ -33,7 +39,7 @@ func New(seed []byte) kyber.XOF {
 			panic("blake2b.XOF.Write should not return error: " + err.Error())
 		}
 	}
-	return &xof{impl: b}
+	return b
 }
 
 func (x *xof) Clone() kyber.XOF {
@@ -56,9 +62,9 @@ func (x *xof) Reseed() {
 		x.key = x.key[0:128]
 	}
 	x.Read(x.key)
-	y := New(x.key)
-	// Steal the XOF implementation, and put it inside of x.
-	x.impl = y.(*xof).impl
+	// The key of a Blake2b XOF is fixed at creation, so unlike Shake256
+	// it cannot be reset into the new state.
+	x.impl = newImpl(x.key)
 	return
 }
 
@@ -32,7 +32,9 @@ func (x *xof) Reseed() {
 		x.key = x.key[0:128]
 	}
 	x.Read(x.key)
-	x.sh = sha3.NewShake256()
+	// Resetting is the same as starting a fresh Shake256, without
+	// allocating a new one.
+	x.sh.Reset()
 	x.sh.Write(x.key)
 	return
 }
@@ -0,0 +1,27 @@
+package xof
+
+import (
+	"encoding/binary"
+
+	"github.com/dedis/kyber"
+)
+
+// Split derives n child XOFs from x, for instance to hand independent
+// streams to parallel workers. It reseeds x and derives the children from
+// clones of the result, each absorbing a distinct index, while x absorbs
+// a label of its own; the children and the later output of x are thus all
+// independent of each other, yet fully determined by the state of x
+// before the call. The children are still writeable, like x.
+func Split(x kyber.XOF, n int) []kyber.XOF {
+	x.Reseed()
+	children := make([]kyber.XOF, n)
+	var label [13]byte
+	copy(label[:], "child")
+	for i := range children {
+		binary.BigEndian.PutUint64(label[5:], uint64(i))
+		children[i] = x.Clone()
+		_, _ = children[i].Write(label[:])
+	}
+	_, _ = x.Write([]byte("parent"))
+	return children
+}
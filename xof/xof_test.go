@@ -2,6 +2,7 @@ package xof
 
 import (
 	"bytes"
+	"fmt"
 	"math"
 	"testing"
 
@@ -237,3 +238,50 @@ func testEncDecMismatch(t *testing.T, s kyber.XOFFactory) {
 		t.Fatal("wrong decode")
 	}
 }
+
+func TestSplit(t *testing.T) {
+	for _, i := range impls {
+		testSplit(t, i)
+	}
+}
+
+func testSplit(t *testing.T, s kyber.XOFFactory) {
+	t.Logf("implementation %T", s)
+	x1 := s.XOF([]byte("seed"))
+	x2 := s.XOF([]byte("seed"))
+	c1 := Split(x1, 4)
+	c2 := Split(x2, 4)
+	require.Len(t, c1, 4)
+
+	outs := make([][]byte, 0, 5)
+	for i := range c1 {
+		out1, out2 := make([]byte, 256), make([]byte, 256)
+		c1[i].Read(out1)
+		c2[i].Read(out2)
+		require.Equal(t, out1, out2, "children are not deterministic")
+		outs = append(outs, out1)
+	}
+	out := make([]byte, 256)
+	x1.Read(out)
+	outs = append(outs, out)
+	for i := range outs {
+		for j := 0; j < i; j++ {
+			if d := bitDiff(outs[i], outs[j]); math.Abs(d-0.50) > 0.1 {
+				t.Fatalf("streams %d and %d: bitDiff %v", j, i, d)
+			}
+		}
+	}
+	require.Len(t, Split(x1, 0), 0)
+}
+
+func BenchmarkReseed(b *testing.B) {
+	for _, s := range impls {
+		x := s.XOF([]byte("seed"))
+		b.Run(fmt.Sprintf("%T", s), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				x.Reseed()
+			}
+		})
+	}
+}